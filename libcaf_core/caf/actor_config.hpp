@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <string>
 
 #include "caf/abstract_channel.hpp"
@@ -36,6 +38,11 @@ public:
 
   using init_fun_type = detail::unique_function<behavior(local_actor*)>;
 
+  // -- constants --------------------------------------------------------------
+
+  /// Denotes that an actor has no affinity to a particular worker.
+  static constexpr size_t no_worker = std::numeric_limits<size_t>::max();
+
   // -- constructors, destructors, and assignment operators --------------------
 
   explicit actor_config(execution_unit* host = nullptr,
@@ -49,6 +56,14 @@ public:
   input_range<const group>* groups;
   detail::unique_function<behavior(local_actor*)> init_fun;
 
+  /// Pins a scheduled actor to the worker with this ID. Only work-stealing
+  /// schedulers respect this setting.
+  size_t pinned_worker;
+
+  /// Places a scheduled actor into this scheduler pool. Actors run in the
+  /// default scheduler of the actor system if this pointer is `nullptr`.
+  scheduler::abstract_coordinator* pool;
+
   // -- properties -------------------------------------------------------------
 
   actor_config& add_flag(int x) {
@@ -27,6 +27,7 @@
 #include <mutex>
 #include <string>
 #include <typeinfo>
+#include <vector>
 
 #include "caf/abstract_actor.hpp"
 #include "caf/actor_cast.hpp"
@@ -38,6 +39,8 @@
 #include "caf/composable_behavior_based_actor.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/init_fun_factory.hpp"
+#include "caf/detail/private_thread_pool.hpp"
+#include "caf/detail/slab_pool.hpp"
 #include "caf/detail/spawn_fwd.hpp"
 #include "caf/detail/spawnable.hpp"
 #include "caf/fwd.hpp"
@@ -51,6 +54,8 @@
 #include "caf/scoped_execution_unit.hpp"
 #include "caf/spawn_options.hpp"
 #include "caf/string_algorithms.hpp"
+#include "caf/string_view.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 #include "caf/uniform_type_info_map.hpp"
 
 namespace caf {
@@ -184,6 +189,8 @@ public:
 
   using module_array = std::array<module_ptr, module::num_ids>;
 
+  using memory_pool_statistics = detail::slab_pool::statistics;
+
   /// @warning The system stores a reference to `cfg`, which means the
   ///          config object must outlive the actor system.
   explicit actor_system(actor_system_config& cfg);
@@ -247,6 +254,10 @@ public:
   /// Returns the scheduler instance.
   scheduler::abstract_coordinator& scheduler();
 
+  /// Returns the scheduler pool `name` as configured in `scheduler.pools` or
+  /// `nullptr` if no such pool exists.
+  scheduler::abstract_coordinator* scheduler_pool(string_view name) noexcept;
+
   /// Returns the system-wide event logger.
   caf::logger& logger();
 
@@ -293,6 +304,26 @@ public:
   /// Returns the last given actor ID.
   actor_id latest_actor_id() const;
 
+  /// Returns counters of the process-wide memory pool for mailbox elements
+  /// and messages, aggregated over all threads.
+  memory_pool_statistics memory_pool_stats() const;
+
+  /// Returns the registry for all metrics of this actor system.
+  telemetry::metric_registry& metrics() noexcept {
+    return metrics_;
+  }
+
+  /// Returns whether the scheduler and actors collect metrics, as configured
+  /// by `metrics.enable`.
+  bool metrics_enabled() const noexcept {
+    return metrics_enabled_;
+  }
+
+  /// Returns the cache of OS threads for detached and blocking actors.
+  detail::private_thread_pool& private_threads() noexcept {
+    return private_threads_;
+  }
+
   /// Blocks this caller until all actors are done.
   void await_all_actors_done() const;
 
@@ -463,6 +494,36 @@ public:
     return spawn_in_groups<T, Os>({grp}, std::forward<Ts>(xs)...);
   }
 
+  /// Returns a new functor-based actor running in the scheduler pool `name`
+  /// or an invalid handle if no such pool exists.
+  template <spawn_options Os = no_spawn_options, class F, class... Ts>
+  infer_handle_from_fun_t<F> spawn_in_pool(string_view name, F fun,
+                                           Ts&&... xs) {
+    using impl = infer_impl_from_fun_t<F>;
+    check_invariants<impl>();
+    static constexpr bool spawnable = detail::spawnable<F, impl, Ts...>();
+    static_assert(spawnable,
+                  "cannot spawn function-based actor with given arguments");
+    actor_config cfg;
+    cfg.pool = checked_scheduler_pool(name);
+    if (cfg.pool == nullptr)
+      return {};
+    return spawn_functor<Os>(detail::bool_token<spawnable>{}, cfg, fun,
+                             std::forward<Ts>(xs)...);
+  }
+
+  /// Returns a new class-based actor running in the scheduler pool `name`
+  /// or an invalid handle if no such pool exists.
+  template <class T, spawn_options Os = no_spawn_options, class... Ts>
+  infer_handle_from_class_t<T> spawn_in_pool(string_view name, Ts&&... xs) {
+    check_invariants<T>();
+    actor_config cfg;
+    cfg.pool = checked_scheduler_pool(name);
+    if (cfg.pool == nullptr)
+      return {};
+    return spawn_impl<T, Os>(cfg, detail::spawn_fwd<Ts>(xs)...);
+  }
+
   /// Returns whether this actor system calls `await_all_actors_done`
   /// in its destructor before shutting down.
   bool await_actors_before_shutdown() const {
@@ -588,6 +649,9 @@ private:
                   "Probably you have tried to spawn a broker.");
   }
 
+  /// Returns `scheduler_pool(name)` and prints a warning if it's `nullptr`.
+  scheduler::abstract_coordinator* checked_scheduler_pool(string_view name);
+
   expected<strong_actor_ptr>
   dyn_spawn_impl(const std::string& name, message& args, execution_unit* ctx,
                  bool check_interface, optional<const mpi&> expected_ifs);
@@ -628,6 +692,9 @@ private:
   /// Stores optional actor system components.
   module_array modules_;
 
+  /// Stores additional scheduler pools as configured in `scheduler.pools`.
+  std::vector<std::unique_ptr<scheduler::abstract_coordinator>> pools_;
+
   /// Provides pseudo scheduling context to actors.
   scoped_execution_unit dummy_execution_unit_;
 
@@ -664,6 +731,15 @@ private:
 
   /// Stores the system-wide factory for deserializing tracing data.
   tracing_data_factory* tracing_context_;
+
+  /// Stores all metrics of this actor system.
+  telemetry::metric_registry metrics_;
+
+  /// Stores whether the scheduler and actors collect metrics.
+  bool metrics_enabled_;
+
+  /// Caches OS threads for detached and blocking actors.
+  detail::private_thread_pool private_threads_;
 };
 
 } // namespace caf
@@ -282,6 +282,35 @@ struct CAF_CORE_EXPORT config_value_access<std::string>
   }
 };
 
+/// Grants access to nested values of any type, e.g., for options that store
+/// dictionaries with user-defined keys.
+template <>
+struct CAF_CORE_EXPORT config_value_access<config_value> {
+  static std::string type_name() {
+    return "config_value";
+  }
+
+  static bool is(const config_value&) {
+    return true;
+  }
+
+  static const config_value* get_if(const config_value* x) {
+    return x;
+  }
+
+  static config_value get(const config_value& x) {
+    return x;
+  }
+
+  static config_value convert(config_value x) {
+    return x;
+  }
+
+  static void parse_cli(string_parser_state& ps, config_value& x) {
+    detail::parse(ps, x);
+  }
+};
+
 enum class select_config_value_hint {
   is_integral,
   is_map,
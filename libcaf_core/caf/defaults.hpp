@@ -20,6 +20,7 @@
 
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -53,8 +54,18 @@ namespace scheduler {
 extern CAF_CORE_EXPORT const atom_value policy;
 extern CAF_CORE_EXPORT string_view profiling_output_file;
 extern CAF_CORE_EXPORT const size_t max_threads;
+extern CAF_CORE_EXPORT const size_t max_cached_threads;
+extern CAF_CORE_EXPORT const timespan cached_thread_timeout;
 extern CAF_CORE_EXPORT const size_t max_throughput;
+extern CAF_CORE_EXPORT const timespan max_resume_time;
+extern CAF_CORE_EXPORT const bool adaptive_resume_time;
 extern CAF_CORE_EXPORT const timespan profiling_resolution;
+extern CAF_CORE_EXPORT const bool affinity;
+extern CAF_CORE_EXPORT const bool numa_aware;
+extern CAF_CORE_EXPORT const bool sticky_scheduling;
+extern CAF_CORE_EXPORT const size_t sticky_max_backlog;
+extern CAF_CORE_EXPORT const atom_value clock;
+extern CAF_CORE_EXPORT const timespan clock_resolution;
 
 } // namespace scheduler
 
@@ -70,6 +81,20 @@ extern CAF_CORE_EXPORT const timespan relaxed_sleep_duration;
 
 } // namespace work_stealing
 
+namespace memory {
+
+extern CAF_CORE_EXPORT const bool enable_pooling;
+extern CAF_CORE_EXPORT const size_t max_cached_blocks;
+extern CAF_CORE_EXPORT const size_t return_batch_size;
+
+} // namespace memory
+
+namespace metrics {
+
+extern CAF_CORE_EXPORT const bool enable;
+
+} // namespace metrics
+
 namespace logger {
 
 extern CAF_CORE_EXPORT string_view component_filter;
@@ -91,6 +116,9 @@ extern CAF_CORE_EXPORT const size_t heartbeat_interval;
 extern CAF_CORE_EXPORT const size_t cached_udp_buffers;
 extern CAF_CORE_EXPORT const size_t max_pending_msgs;
 extern CAF_CORE_EXPORT const size_t workers;
+extern CAF_CORE_EXPORT const size_t multiplexer_threads;
+extern CAF_CORE_EXPORT const uint16_t prometheus_http_port;
+extern CAF_CORE_EXPORT string_view prometheus_http_address;
 
 } // namespace middleman
 
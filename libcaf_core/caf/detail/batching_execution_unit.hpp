@@ -0,0 +1,67 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/execution_unit.hpp"
+#include "caf/fwd.hpp"
+#include "caf/mailbox_element.hpp"
+
+namespace caf::detail {
+
+/// Collects actors that become ready while sending one message to many
+/// receivers and hands them to the scheduler in a single batch. This allows
+/// the scheduler to distribute all jobs with one lock acquisition and one
+/// wakeup per worker instead of paying for both on each receiver.
+class CAF_CORE_EXPORT batching_execution_unit : public execution_unit {
+public:
+  using super = execution_unit;
+
+  /// Creates a batch that inherits the proxy registry from `host`, which is
+  /// the execution unit of the sender or `nullptr`.
+  explicit batching_execution_unit(execution_unit* host) noexcept;
+
+  batching_execution_unit(const batching_execution_unit&) = delete;
+
+  batching_execution_unit& operator=(const batching_execution_unit&) = delete;
+
+  /// Passes all pending jobs to the scheduler.
+  ~batching_execution_unit() override;
+
+  /// Defers `ptr` until the next call to `flush`.
+  void exec_later(resumable* ptr) override;
+
+  /// Enqueues `what` to the mailbox of `dest` and defers scheduling `dest`.
+  void enqueue(abstract_actor* dest, mailbox_element_ptr what);
+
+  /// Passes all pending jobs to the scheduler.
+  void flush();
+
+  /// Returns the number of jobs waiting for the next call to `flush`.
+  size_t pending() const noexcept {
+    return jobs_.size();
+  }
+
+private:
+  std::vector<resumable*> jobs_;
+};
+
+} // namespace caf::detail
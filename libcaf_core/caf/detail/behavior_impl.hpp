@@ -20,6 +20,8 @@
 
 #include <tuple>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #include "caf/atom.hpp"
 #include "caf/detail/apply_args.hpp"
@@ -54,6 +56,10 @@ class CAF_CORE_EXPORT behavior_impl : public ref_counted {
 public:
   using pointer = intrusive_ptr<behavior_impl>;
 
+  /// Minimum number of match cases for building a dispatch table. Smaller
+  /// behaviors, e.g., response handlers, scan their match cases linearly.
+  static constexpr size_t dispatch_threshold = 8;
+
   ~behavior_impl() override;
 
   behavior_impl();
@@ -80,9 +86,30 @@ public:
   pointer or_else(const pointer& other);
 
 protected:
+  /// Builds the dispatch table for the match cases in `[begin_, end_)`.
+  void init_dispatch();
+
   timespan timeout_;
   match_case_info* begin_;
   match_case_info* end_;
+
+private:
+  /// Match cases in order of definition.
+  using case_list = std::vector<match_case*>;
+
+  /// Candidates for messages with a given type token.
+  struct dispatch_entry {
+    /// Match cases without a leading atom constant.
+    case_list generic;
+
+    /// Match cases for messages starting with a given atom, including all
+    /// match cases without leading atom constant.
+    std::unordered_map<atom_value, case_list> by_atom;
+  };
+
+  /// Maps type tokens to candidates. Empty for behaviors with less than
+  /// `dispatch_threshold` match cases.
+  std::unordered_map<uint32_t, dispatch_entry> dispatch_;
 };
 
 template <class Tuple>
@@ -167,6 +194,7 @@ private:
             std::integral_constant<size_t, Last>) {
     this->begin_ = arr_.data();
     this->end_ = arr_.data() + arr_.size();
+    this->init_dispatch();
     std::integral_constant<bool, has_timeout> token;
     set_timeout(token);
   }
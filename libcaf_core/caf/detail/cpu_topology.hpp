@@ -0,0 +1,97 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/string_view.hpp"
+
+namespace caf::detail {
+
+/// Describes the position of a logical CPU in the memory hierarchy.
+struct CAF_CORE_EXPORT cpu_info {
+  /// Logical CPU ID as used by the OS.
+  size_t id;
+
+  /// ID of the physical core (unique per package).
+  size_t core;
+
+  /// ID of the physical package (socket).
+  size_t package;
+
+  /// ID of the NUMA node.
+  size_t numa_node;
+
+  /// ID of the group of CPUs sharing the last-level (L3) cache.
+  size_t cache_group;
+
+  /// Index of this CPU among the SMT siblings of its core.
+  size_t smt_rank;
+};
+
+/// Stores which worker runs on which CPU and in what order workers steal from
+/// each other.
+struct CAF_CORE_EXPORT worker_placement {
+  /// CPU per worker, indexed by worker ID.
+  std::vector<cpu_info> cpus;
+
+  /// Victims per worker, grouped into tiers of increasing distance: workers
+  /// sharing the last-level cache, workers on the same NUMA node and finally
+  /// all remaining workers.
+  std::vector<std::vector<std::vector<size_t>>> steal_tiers;
+};
+
+/// Describes the CPU layout of the host.
+class CAF_CORE_EXPORT cpu_topology {
+public:
+  cpu_topology() = default;
+
+  explicit cpu_topology(std::vector<cpu_info> cpus);
+
+  /// Queries the layout of the host. On Linux, reads the layout from
+  /// `/sys/devices/system/cpu` and `/sys/devices/system/node`. On all other
+  /// platforms, returns a flat topology with `hardware_concurrency` CPUs.
+  static cpu_topology detect();
+
+  /// Parses a Linux CPU list such as `0-3,8,10-11`.
+  static std::vector<size_t> parse_cpu_list(string_view str);
+
+  /// Returns all known CPUs.
+  const std::vector<cpu_info>& cpus() const noexcept {
+    return cpus_;
+  }
+
+  /// Assigns `num_workers` workers to CPUs, spreading workers across physical
+  /// cores before placing them on SMT siblings and filling cache groups and
+  /// NUMA nodes one after another.
+  worker_placement place(size_t num_workers) const;
+
+private:
+  std::vector<cpu_info> cpus_;
+};
+
+/// Pins `thread` to the logical CPU `cpu`. Returns `false` if the platform
+/// does not support thread affinity or if the OS rejected the request.
+CAF_CORE_EXPORT bool set_thread_affinity(std::thread& thread, size_t cpu);
+
+} // namespace caf::detail
@@ -131,6 +131,26 @@ public:
     tail_ = tmp;
   }
 
+  // acquires only one lock for all values in [first, last)
+  template <class Iterator>
+  void append(Iterator first, Iterator last) {
+    if (first == last)
+      return;
+    // link all nodes before acquiring the lock
+    auto head = new node(*first);
+    auto tail = head;
+    for (++first; first != last; ++first) {
+      CAF_ASSERT(*first != nullptr);
+      auto tmp = new node(*first);
+      tail->next = tmp;
+      tail = tmp;
+    }
+    lock_guard guard(tail_lock_);
+    // publish & swing last forward
+    tail_.load()->next = head;
+    tail_ = tail;
+  }
+
   // acquires both locks
   void prepend(pointer value) {
     CAF_ASSERT(value != nullptr);
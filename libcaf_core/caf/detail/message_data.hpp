@@ -19,6 +19,7 @@
 #pragma once
 
 #include <iterator>
+#include <new>
 #include <string>
 #include <typeinfo>
 
@@ -56,6 +57,27 @@ public:
   using type_erased_tuple::copy;
 
   bool shared() const noexcept override;
+
+#ifndef CAF_NO_MEM_MANAGEMENT
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates memory for derived types from the @ref detail::slab_pool.
+  static void* operator new(size_t bytes);
+
+  static void* operator new(size_t, void* ptr) noexcept {
+    return ptr;
+  }
+
+  static void* operator new(size_t bytes, std::align_val_t alignment) {
+    return ::operator new(bytes, alignment);
+  }
+
+  static void operator delete(void* ptr) noexcept;
+
+  static void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    ::operator delete(ptr, alignment);
+  }
+#endif // CAF_NO_MEM_MANAGEMENT
 };
 
 } // namespace caf::detail
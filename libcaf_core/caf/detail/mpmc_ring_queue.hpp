@@ -0,0 +1,164 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "caf/config.hpp"
+
+namespace caf::detail {
+
+/// A multi-producer, multi-consumer queue for pointers that stores elements
+/// in a bounded, lock-free ring (based on Dmitry Vyukov's bounded MPMC queue)
+/// and only falls back to a mutex-guarded overflow list if the ring is full.
+/// Consumers never touch the mutex as long as no overflow occurred.
+template <class T>
+class mpmc_ring_queue {
+public:
+  using value_type = T;
+  using pointer = value_type*;
+
+  static constexpr size_t default_log_capacity = 10;
+
+  explicit mpmc_ring_queue(size_t log_capacity = default_log_capacity)
+    : mask_((size_t{1} << log_capacity) - 1),
+      cells_(new cell[size_t{1} << log_capacity]),
+      enqueue_pos_(0),
+      dequeue_pos_(0),
+      overflow_size_(0) {
+    for (size_t i = 0; i <= mask_; ++i)
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+
+  mpmc_ring_queue(const mpmc_ring_queue&) = delete;
+
+  mpmc_ring_queue& operator=(const mpmc_ring_queue&) = delete;
+
+  /// Appends `value` to the queue. Never fails.
+  void push(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    if (try_push(value))
+      return;
+    std::unique_lock<std::mutex> guard{overflow_mtx_};
+    overflow_.push_back(value);
+    overflow_size_.fetch_add(1, std::memory_order_release);
+  }
+
+  /// Tries to append `value` to the lock-free ring. Returns `false` if the
+  /// ring is full.
+  bool try_push(pointer value) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& c = cells_[pos & mask_];
+      auto seq = c.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          c.value = value;
+          c.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Removes the oldest element from the queue. Returns `nullptr` if the
+  /// queue is empty.
+  pointer try_pop() {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    for (;;) {
+      auto& c = cells_[pos & mask_];
+      auto seq = c.sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(pos, pos + 1,
+                                               std::memory_order_relaxed)) {
+          auto result = c.value;
+          c.sequence.store(pos + mask_ + 1, std::memory_order_release);
+          return result;
+        }
+      } else if (diff < 0) {
+        return try_pop_overflow();
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /// Returns an approximation of the current number of elements.
+  size_t size() const noexcept {
+    auto wr = enqueue_pos_.load(std::memory_order_relaxed);
+    auto rd = dequeue_pos_.load(std::memory_order_relaxed);
+    auto ring_size = wr > rd ? wr - rd : size_t{0};
+    return ring_size + overflow_size_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns whether the queue appears empty to the caller.
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  /// Returns the capacity of the lock-free ring.
+  size_t capacity() const noexcept {
+    return mask_ + 1;
+  }
+
+private:
+  struct cell {
+    std::atomic<size_t> sequence;
+    pointer value;
+  };
+
+  pointer try_pop_overflow() {
+    if (overflow_size_.load(std::memory_order_acquire) == 0)
+      return nullptr;
+    std::unique_lock<std::mutex> guard{overflow_mtx_};
+    if (overflow_.empty())
+      return nullptr;
+    auto result = overflow_.front();
+    overflow_.pop_front();
+    overflow_size_.fetch_sub(1, std::memory_order_release);
+    return result;
+  }
+
+  size_t mask_;
+
+  std::unique_ptr<cell[]> cells_;
+
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<size_t> overflow_size_;
+
+  std::mutex overflow_mtx_;
+
+  std::deque<pointer> overflow_;
+};
+
+} // namespace caf::detail
@@ -0,0 +1,125 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+
+namespace caf::detail {
+
+/// An eventcount that allows threads to block until new work becomes
+/// available without polling. Waiting follows a three-step protocol:
+///
+/// ~~~
+/// for (;;) {
+///   auto key = lot.prepare_park();
+///   if (auto job = try_get_job()) {
+///     lot.cancel_park();
+///     return job;
+///   }
+///   lot.park(key);
+/// }
+/// ~~~
+///
+/// Producers call `unpark_one` or `unpark_all` after making new work visible.
+/// Both functions only perform a fence and a single atomic load as long as no
+/// thread is parked. On Linux, parked threads block on a futex. All other
+/// platforms fall back to a mutex and a condition variable.
+class CAF_CORE_EXPORT parking_lot {
+public:
+  using key_type = uint32_t;
+
+  parking_lot();
+
+  parking_lot(const parking_lot&) = delete;
+
+  parking_lot& operator=(const parking_lot&) = delete;
+
+  /// Announces that the calling thread is about to park. The caller must check
+  /// for new work afterwards and then call either `park` or `cancel_park`.
+  key_type prepare_park() noexcept {
+    waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    return epoch_.load(std::memory_order_acquire);
+  }
+
+  /// Reverts a previous call to `prepare_park`.
+  void cancel_park() noexcept {
+    waiters_.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  /// Blocks the calling thread until another thread calls `unpark_one` or
+  /// `unpark_all` after the matching call to `prepare_park`.
+  void park(key_type key);
+
+  /// Wakes up one parked thread, if any.
+  void unpark_one() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) != 0)
+      notify(false);
+  }
+
+  /// Wakes up all parked threads.
+  void unpark_all() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) != 0)
+      notify(true);
+  }
+
+  /// Returns the number of threads that are currently parked or about to park.
+  size_t num_waiters() const noexcept {
+    return waiters_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns how many times threads blocked in `park`.
+  size_t num_parks() const noexcept {
+    return parks_.load(std::memory_order_relaxed);
+  }
+
+  /// Returns how many times producers had to wake up parked threads.
+  size_t num_unparks() const noexcept {
+    return unparks_.load(std::memory_order_relaxed);
+  }
+
+private:
+  void notify(bool all);
+
+  // Incremented on each notification, parked threads wait for it to change.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<key_type> epoch_;
+
+  // Number of threads between `prepare_park` and returning from `park`.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<key_type> waiters_;
+
+  // Statistics.
+  std::atomic<size_t> parks_;
+  std::atomic<size_t> unparks_;
+
+#ifndef CAF_LINUX
+  std::mutex mtx_;
+  std::condition_variable cv_;
+#endif // CAF_LINUX
+};
+
+} // namespace caf::detail
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/unique_function.hpp"
+#include "caf/fwd.hpp"
+#include "caf/timespan.hpp"
+
+namespace caf::detail {
+
+/// Runs detached and blocking actors in dedicated OS threads. Rather than
+/// terminating after its job, a thread waits up to `timeout` for another job.
+/// The pool keeps at most `max_idle` threads waiting at the same time.
+class CAF_CORE_EXPORT private_thread_pool {
+public:
+  // -- member types -----------------------------------------------------------
+
+  using job_type = unique_function<void()>;
+
+  /// Counters for verifying thread reuse.
+  struct statistics {
+    /// Number of OS threads started by the pool.
+    size_t threads_created;
+
+    /// Number of jobs passed to `run`.
+    size_t jobs_started;
+
+    /// Number of threads currently waiting for a job.
+    size_t idle_threads;
+  };
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  private_thread_pool(actor_system& sys, size_t max_idle, timespan timeout);
+
+  private_thread_pool(const private_thread_pool&) = delete;
+
+  private_thread_pool& operator=(const private_thread_pool&) = delete;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns a snapshot of the pool counters.
+  statistics stats() const;
+
+  // -- thread management ------------------------------------------------------
+
+  /// Runs `job` in an idle thread or starts a new thread if none is available.
+  void run(job_type job);
+
+  /// Releases all idle threads and blocks until all threads have terminated.
+  /// @pre No job is running or gets passed to `run` afterwards.
+  void stop();
+
+private:
+  void exec(job_type job);
+
+  actor_system& sys_;
+
+  size_t max_idle_;
+
+  timespan timeout_;
+
+  /// Guards all members below.
+  mutable std::mutex mtx_;
+
+  /// Signals idle threads that a new job or the shutdown request arrived.
+  std::condition_variable jobs_cv_;
+
+  /// Signals `stop` that the last thread terminated.
+  std::condition_variable done_cv_;
+
+  /// Stores jobs that wait for an idle thread to pick them up.
+  std::deque<job_type> pending_;
+
+  /// Number of OS threads that currently belong to the pool.
+  size_t running_ = 0;
+
+  size_t idle_ = 0;
+
+  size_t threads_created_ = 0;
+
+  size_t jobs_started_ = 0;
+
+  bool stopping_ = false;
+};
+
+} // namespace caf::detail
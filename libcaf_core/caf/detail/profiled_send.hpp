@@ -24,10 +24,12 @@
 #include "caf/actor_clock.hpp"
 #include "caf/actor_control_block.hpp"
 #include "caf/actor_profiler.hpp"
+#include "caf/detail/batching_execution_unit.hpp"
 #include "caf/fwd.hpp"
 #include "caf/mailbox_element.hpp"
 #include "caf/message_id.hpp"
 #include "caf/no_stages.hpp"
+#include "caf/telemetry/actor_metrics.hpp"
 
 namespace caf::detail {
 
@@ -35,8 +37,9 @@ template <class Self, class Sender, class Handle, class... Ts>
 void profiled_send(Self* self, Sender&& sender, const Handle& receiver,
                    message_id msg_id, std::vector<strong_actor_ptr> stages,
                    execution_unit* context, Ts&&... xs) {
-  CAF_IGNORE_UNUSED(self);
   if (receiver) {
+    if (auto metrics = self->metrics())
+      metrics->sent->inc();
     auto element = make_mailbox_element(std::forward<Sender>(sender), msg_id,
                                         std::move(stages),
                                         std::forward<Ts>(xs)...);
@@ -49,8 +52,9 @@ template <class Self, class Sender, class Handle, class... Ts>
 void profiled_send(Self* self, Sender&& sender, const Handle& receiver,
                    actor_clock& clock, actor_clock::time_point timeout,
                    message_id msg_id, Ts&&... xs) {
-  CAF_IGNORE_UNUSED(self);
   if (receiver) {
+    if (auto metrics = self->metrics())
+      metrics->sent->inc();
     auto element = make_mailbox_element(std::forward<Sender>(sender), msg_id,
                                         no_stages, std::forward<Ts>(xs)...);
     CAF_BEFORE_SENDING_SCHEDULED(self, timeout, *element);
@@ -59,4 +63,21 @@ void profiled_send(Self* self, Sender&& sender, const Handle& receiver,
   }
 }
 
+template <class Self, class Sender, class Handles>
+void profiled_send_all(Self* self, const Sender& sender,
+                       const Handles& receivers, message_id msg_id,
+                       execution_unit* context, const message& msg) {
+  batching_execution_unit batch{context};
+  auto metrics = self->metrics();
+  for (auto& receiver : receivers) {
+    if (receiver) {
+      if (metrics != nullptr)
+        metrics->sent->inc();
+      auto element = make_mailbox_element(sender, msg_id, no_stages, msg);
+      CAF_BEFORE_SENDING(self, *element);
+      batch.enqueue(actor_cast<abstract_actor*>(receiver), std::move(element));
+    }
+  }
+}
+
 } // namespace caf::detail
@@ -0,0 +1,39 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/fwd.hpp"
+
+namespace caf::detail {
+
+/// Returns the ID of the worker `job` is pinned to or
+/// `actor_config::no_worker` if `job` is not a pinned actor.
+CAF_CORE_EXPORT size_t pinned_worker(const resumable* job) noexcept;
+
+/// Returns the ID of the worker that ran `job` most recently or
+/// `actor_config::no_worker` if `job` is not a scheduled actor.
+CAF_CORE_EXPORT size_t last_worker(const resumable* job) noexcept;
+
+/// Stores `id` as the last worker of `job` if `job` is a scheduled actor.
+CAF_CORE_EXPORT void last_worker(resumable* job, size_t id) noexcept;
+
+} // namespace caf::detail
@@ -300,6 +300,11 @@ public:
 
   void cancel_all() override;
 
+  // -- utility functions ------------------------------------------------------
+
+  /// Delivers the timeout or message stored in `x`.
+  static void ship(delayed_event& x);
+
 protected:
   // -- helper functions -------------------------------------------------------
 
@@ -337,8 +342,6 @@ protected:
 
   void handle(const timeouts_cancellation& x);
 
-  void ship(delayed_event& x);
-
   template <class T>
   detail::enable_if_t<T::cancellable>
   add_schedule_entry(time_point t, std::unique_ptr<T> x) {
@@ -0,0 +1,120 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/meta/type_name.hpp"
+
+namespace caf::detail {
+
+/// Recycles memory for small, short-lived objects such as mailbox elements
+/// and message payloads. Each thread owns a cache with one free list per size
+/// class. Memory released by a thread other than the allocating one travels
+/// back to its owner in batches via a lock-free stack, i.e., the common
+/// pattern of allocating on the sender and releasing on the receiver never
+/// touches a lock.
+class CAF_CORE_EXPORT slab_pool {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of distinct block sizes.
+  static constexpr size_t num_size_classes = 5;
+
+  /// Size of the smallest block in bytes, including bookkeeping.
+  static constexpr size_t min_block_size = 64;
+
+  /// Size of the largest block in bytes, including bookkeeping. Larger
+  /// requests fall back to the global `operator new`.
+  static constexpr size_t max_block_size = min_block_size
+                                           << (num_size_classes - 1);
+
+  /// Default for `max_cached_blocks`.
+  static constexpr size_t default_max_cached_blocks = 512;
+
+  /// Default for `return_batch_size`.
+  static constexpr size_t default_return_batch_size = 32;
+
+  // -- nested types -----------------------------------------------------------
+
+  /// Aggregated counters over all threads.
+  struct statistics {
+    /// Number of allocations served from a free list.
+    uint64_t hits = 0;
+
+    /// Number of allocations that required a new block.
+    uint64_t misses = 0;
+
+    /// Number of allocations that bypassed the pool, either because they
+    /// exceed `max_block_size` or because pooling is disabled.
+    uint64_t bypassed = 0;
+
+    /// Number of blocks released by a thread other than their owner.
+    uint64_t remote_releases = 0;
+
+    /// Returns the fraction of pooled allocations served from a free list.
+    double hit_rate() const noexcept {
+      auto total = hits + misses;
+      return total > 0 ? static_cast<double>(hits) / total : 0.;
+    }
+  };
+
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates at least `bytes` bytes, aligned for any scalar type.
+  static void* allocate(size_t bytes);
+
+  /// Releases memory previously acquired via `allocate`.
+  static void deallocate(void* ptr) noexcept;
+
+  // -- configuration ----------------------------------------------------------
+
+  /// Enables or disables pooling for all threads. Memory acquired while
+  /// pooling was enabled remains safe to release after disabling it and
+  /// vice versa.
+  static void enable(bool flag) noexcept;
+
+  /// Returns whether allocations currently use the pool.
+  static bool enabled() noexcept;
+
+  /// Sets how many free blocks per size class a thread keeps at most before
+  /// returning memory to the system.
+  static void max_cached_blocks(size_t num) noexcept;
+
+  /// Sets how many blocks a thread collects before sending them back to their
+  /// owner.
+  static void return_batch_size(size_t num) noexcept;
+
+  // -- observers --------------------------------------------------------------
+
+  /// Returns counters aggregated over all threads that used the pool.
+  static statistics stats();
+};
+
+/// @relates slab_pool::statistics
+template <class Inspector>
+typename Inspector::result_type
+inspect(Inspector& f, slab_pool::statistics& x) {
+  return f(meta::type_name("slab_pool_statistics"), x.hits, x.misses,
+           x.bypassed, x.remote_releases);
+}
+
+} // namespace caf::detail
@@ -0,0 +1,284 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "caf/actor_clock.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/simple_actor_clock.hpp"
+#include "caf/timespan.hpp"
+
+namespace caf::detail {
+
+/// A thread-safe actor clock based on a hierarchical timing wheel. Timeouts
+/// go to one of several shards depending on the ID of the actor. Each shard
+/// has its own lock, wheel and lookup tables. Hence, actors on different
+/// workers rarely contend when setting or cancelling timeouts and both
+/// operations run in constant time. Cancelled timeouts stay in their bucket
+/// until the wheel reaches it, but release the actor they refer to
+/// immediately. A single dispatcher thread advances all shards and only wakes
+/// up for buckets that contain timeouts.
+class CAF_CORE_EXPORT timer_wheel_actor_clock : public actor_clock {
+public:
+  // -- constants --------------------------------------------------------------
+
+  /// Number of bits for indexing a bucket within a level.
+  static constexpr size_t slot_bits = 6;
+
+  /// Number of buckets per level.
+  static constexpr size_t num_slots = size_t{1} << slot_bits;
+
+  /// Number of levels. With a resolution of 1ms, the last level covers about
+  /// 4.6 hours. Timeouts beyond that range get re-inserted periodically.
+  static constexpr size_t num_levels = 4;
+
+  // -- member types -----------------------------------------------------------
+
+  using super = actor_clock;
+
+  /// Measures time in multiples of the resolution.
+  using tick_type = uint64_t;
+
+  /// Type-erased event from the simple clock implementation.
+  using delayed_event = simple_actor_clock::delayed_event;
+
+  /// Owning pointer to delayed events.
+  using unique_delayed_event_ptr = std::unique_ptr<delayed_event>;
+
+  // -- constructors, destructors, and assignment operators --------------------
+
+  timer_wheel_actor_clock(size_t num_shards, timespan resolution);
+
+  timer_wheel_actor_clock(const timer_wheel_actor_clock&) = delete;
+
+  timer_wheel_actor_clock& operator=(const timer_wheel_actor_clock&) = delete;
+
+  ~timer_wheel_actor_clock() override;
+
+  // -- properties -------------------------------------------------------------
+
+  /// Returns the number of shards.
+  size_t num_shards() const noexcept {
+    return shards_.size();
+  }
+
+  /// Returns the number of pending events, including cancelled timeouts that
+  /// still wait for their bucket to expire.
+  size_t num_pending();
+
+  // -- overridden member functions --------------------------------------------
+
+  void set_ordinary_timeout(time_point t, abstract_actor* self, atom_value type,
+                            uint64_t id) override;
+
+  void set_multi_timeout(time_point t, abstract_actor* self, atom_value type,
+                         uint64_t id) override;
+
+  void set_request_timeout(time_point t, abstract_actor* self,
+                           message_id id) override;
+
+  void cancel_ordinary_timeout(abstract_actor* self, atom_value type) override;
+
+  void cancel_request_timeout(abstract_actor* self, message_id id) override;
+
+  void cancel_timeouts(abstract_actor* self) override;
+
+  void schedule_message(time_point t, strong_actor_ptr receiver,
+                        mailbox_element_ptr content) override;
+
+  void schedule_message(time_point t, group target, strong_actor_ptr sender,
+                        message content) override;
+
+  void cancel_all() override;
+
+  // -- dispatching ------------------------------------------------------------
+
+  /// Ships all events that are due at `t`.
+  /// @returns The number of shipped events.
+  size_t trigger_expired_timeouts(time_point t);
+
+  /// Ships events until calling `cancel_dispatch_loop`.
+  void run_dispatch_loop();
+
+  /// Stops a thread running `run_dispatch_loop`.
+  void cancel_dispatch_loop();
+
+private:
+  // -- member types -----------------------------------------------------------
+
+  /// Selects how to cancel a timer.
+  enum class timeout_kind : uint8_t {
+    /// Delayed messages and cancelled timeouts.
+    message,
+    /// Cancellable via `cancel_timeouts`.
+    multi,
+    /// Cancellable via `cancel_ordinary_timeout` or `cancel_timeouts`.
+    ordinary,
+    /// Cancellable via `cancel_request_timeout` or `cancel_timeouts`.
+    request,
+  };
+
+  /// Identifies a cancellable timeout.
+  struct timeout_key {
+    actor_id aid;
+    timeout_kind kind;
+    uint64_t id;
+
+    bool operator==(const timeout_key& other) const noexcept {
+      return aid == other.aid && kind == other.kind && id == other.id;
+    }
+  };
+
+  struct timeout_key_hash {
+    size_t operator()(const timeout_key& x) const noexcept;
+  };
+
+  /// An entry in the wheel.
+  struct timer {
+    /// Tick at which this timer expires.
+    tick_type due;
+
+    /// Next timer in the same bucket.
+    timer* next = nullptr;
+
+    /// Previous timer of the same actor.
+    timer* prev_of_actor = nullptr;
+
+    /// Next timer of the same actor.
+    timer* next_of_actor = nullptr;
+
+    /// Selects the shard and the list of cancellable timers.
+    actor_id aid = 0;
+
+    /// Selects the lookup table containing this timer.
+    timeout_kind kind = timeout_kind::message;
+
+    /// Key in the lookup table for ordinary and request timeouts.
+    uint64_t id = 0;
+
+    /// Points to `nullptr` after cancelling the timer.
+    unique_delayed_event_ptr event;
+  };
+
+  /// A FIFO list of timers.
+  struct bucket {
+    timer* head = nullptr;
+    timer* tail = nullptr;
+  };
+
+  /// A partition of the wheel with its own lock.
+  struct shard {
+    std::mutex mtx;
+
+    /// Last tick processed by this shard.
+    tick_type cursor = 0;
+
+    /// Number of timers in all buckets.
+    size_t size = 0;
+
+    /// Buckets of all levels.
+    std::array<std::array<bucket, num_slots>, num_levels> levels;
+
+    /// Maps actor IDs to their first cancellable timer.
+    std::unordered_map<actor_id, timer*> by_actor;
+
+    /// Maps ordinary and request timeouts to their timer.
+    std::unordered_map<timeout_key, timer*, timeout_key_hash> by_key;
+  };
+
+  // -- utility functions ------------------------------------------------------
+
+  tick_type to_tick(time_point t, bool round_up) const noexcept;
+
+  time_point to_time_point(tick_type tick) const noexcept;
+
+  shard& shard_for(actor_id aid) noexcept {
+    return *shards_[aid % shards_.size()];
+  }
+
+  /// Adds `x` to the matching bucket of `s`.
+  static void insert(shard& s, timer* x);
+
+  /// Adds `x` to the lookup tables of `s`.
+  static void link(shard& s, timer* x);
+
+  /// Removes `x` from the lookup tables of `s`.
+  static void unlink(shard& s, timer* x);
+
+  /// Cancels the timer for `key` if it exists.
+  void cancel(const timeout_key& key);
+
+  /// Moves all timers of a bucket at `level` to lower levels.
+  static void cascade(shard& s, size_t level);
+
+  /// Advances `s` to `tick` and moves expired events to `out`.
+  static void advance(shard& s, tick_type tick,
+                      std::vector<unique_delayed_event_ptr>& out);
+
+  /// Returns the tick at which `s` needs to advance next.
+  static tick_type next_tick(shard& s);
+
+  /// Deletes all timers in `s` and moves their events to `out`.
+  static void clear(shard& s, std::vector<unique_delayed_event_ptr>& out);
+
+  /// Advances all shards to `tick`, ships expired events and stores the tick
+  /// for the next call in `next`.
+  /// @returns The number of shipped events.
+  size_t dispatch(tick_type tick, tick_type& next);
+
+  /// Inserts a new timer and wakes up the dispatcher if necessary.
+  void add(actor_id aid, timeout_kind kind, uint64_t id, time_point t,
+           unique_delayed_event_ptr event);
+
+  // -- member variables -------------------------------------------------------
+
+  /// Maps tick 0 to a point in time.
+  time_point epoch_;
+
+  /// Length of a tick.
+  duration_type resolution_;
+
+  /// Partitions of the wheel.
+  std::vector<std::unique_ptr<shard>> shards_;
+
+  /// Earliest due tick of all insertions since the last dispatcher run.
+  std::atomic<tick_type> min_insert_;
+
+  /// Tick at which the dispatcher wakes up next.
+  std::atomic<tick_type> wakeup_tick_;
+
+  /// Signals shutdown to the dispatcher.
+  bool shutdown_ = false;
+
+  /// Protects `shutdown_` and the condition variable.
+  std::mutex mtx_;
+
+  /// Wakes up the dispatcher.
+  std::condition_variable cv_;
+};
+
+} // namespace caf::detail
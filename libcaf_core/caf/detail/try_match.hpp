@@ -63,6 +63,20 @@ struct meta_element_factory<atom_constant<V>, type_nr<atom_value>::value> {
   }
 };
 
+/// Checks whether a pattern starts with an `atom_constant` and extracts its
+/// value if it does.
+template <class Pattern>
+struct leading_atom_constant {
+  static constexpr bool valid = false;
+  static constexpr atom_value value = static_cast<atom_value>(0);
+};
+
+template <atom_value V, class... Ts>
+struct leading_atom_constant<type_list<atom_constant<V>, Ts...>> {
+  static constexpr bool valid = true;
+  static constexpr atom_value value = V;
+};
+
 template <class TypeList>
 struct meta_elements;
 
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/timespan.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)              \
+  || defined(_M_IX86)
+#  define CAF_HAS_TSC
+#  ifdef CAF_MSVC
+#    include <intrin.h>
+#  else
+#    include <x86intrin.h>
+#  endif
+#endif
+
+namespace caf::detail {
+
+/// A cheap monotonic clock for measuring short intervals on hot code paths.
+/// Reads the time stamp counter (TSC) on x86 and falls back to
+/// `std::chrono::steady_clock` on all other platforms. CAF calibrates the
+/// ratio between ticks and nanoseconds once per process.
+/// @note Assumes an invariant TSC, i.e., a counter with constant rate that is
+///       synchronized across cores. All x86 CPUs of the past decade qualify.
+class CAF_CORE_EXPORT tsc_clock {
+public:
+  using tick_type = uint64_t;
+
+  /// Returns the current number of ticks.
+  static tick_type now() noexcept {
+#ifdef CAF_HAS_TSC
+    return __rdtsc();
+#else
+    using namespace std::chrono;
+    auto t = steady_clock::now().time_since_epoch();
+    return static_cast<tick_type>(duration_cast<nanoseconds>(t).count());
+#endif
+  }
+
+  /// Returns how many ticks pass per nanosecond.
+  static double ticks_per_ns() noexcept;
+
+  /// Converts `x` to ticks.
+  static tick_type ticks(timespan x) noexcept {
+    return static_cast<tick_type>(x.count() * ticks_per_ns());
+  }
+
+  /// Converts `x` ticks to a timespan.
+  static timespan duration(tick_type x) noexcept {
+    return timespan{static_cast<timespan::rep>(x / ticks_per_ns())};
+  }
+};
+
+} // namespace caf::detail
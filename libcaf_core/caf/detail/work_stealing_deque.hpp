@@ -0,0 +1,189 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "caf/config.hpp"
+
+namespace caf::detail {
+
+/// A lock-free, growable work-stealing deque based on the algorithm by Chase
+/// and Lev ("Dynamic Circular Work-Stealing Deque", SPAA 2005) with the memory
+/// orderings from Lê et al. ("Correct and Efficient Work-Stealing for Weak
+/// Memory Models", PPoPP 2013). The owner pushes and pops at the bottom end
+/// while any number of thieves may concurrently steal from the top end.
+/// @warning `push` and `take` must only be called by the owning thread.
+template <class T>
+class work_stealing_deque {
+public:
+  using value_type = T;
+  using pointer = value_type*;
+  using index_type = int64_t;
+
+  static constexpr size_t default_log_capacity = 8;
+
+  explicit work_stealing_deque(size_t log_capacity = default_log_capacity)
+    : top_(0), bottom_(0) {
+    auto buf = new buffer(log_capacity);
+    buffers_.emplace_back(buf);
+    buf_ = buf;
+  }
+
+  work_stealing_deque(const work_stealing_deque&) = delete;
+
+  work_stealing_deque& operator=(const work_stealing_deque&) = delete;
+
+  /// Pushes `value` to the bottom of the deque, growing the underlying buffer
+  /// if necessary. Never fails.
+  void push(pointer value) {
+    CAF_ASSERT(value != nullptr);
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_acquire);
+    auto buf = buf_.load(std::memory_order_relaxed);
+    if (b - t > static_cast<index_type>(buf->capacity()) - 1)
+      buf = grow(buf, t, b);
+    buf->store(b, value);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom_.store(b + 1, std::memory_order_relaxed);
+  }
+
+  /// Removes the most recently pushed element from the bottom of the deque.
+  /// Returns `nullptr` if the deque is empty.
+  pointer take() {
+    auto b = bottom_.load(std::memory_order_relaxed) - 1;
+    auto buf = buf_.load(std::memory_order_relaxed);
+    bottom_.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_relaxed);
+    if (t > b) {
+      // Deque was already empty.
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    auto result = buf->load(b);
+    if (t == b) {
+      // Last element: race against thieves.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed))
+        result = nullptr;
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return result;
+  }
+
+  /// Removes the oldest element from the top of the deque. Safe to call from
+  /// any thread. Returns `nullptr` if the deque is empty or if this thief
+  /// lost a race against the owner or another thief.
+  pointer steal() {
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto b = bottom_.load(std::memory_order_acquire);
+    if (t >= b)
+      return nullptr;
+    // Note: memory_order_consume would suffice, but compilers promote it to
+    // acquire anyway.
+    auto buf = buf_.load(std::memory_order_acquire);
+    auto result = buf->load(t);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed))
+      return nullptr;
+    return result;
+  }
+
+  /// Returns an approximation of the current number of elements.
+  size_t size() const noexcept {
+    auto b = bottom_.load(std::memory_order_relaxed);
+    auto t = top_.load(std::memory_order_relaxed);
+    return b > t ? static_cast<size_t>(b - t) : 0u;
+  }
+
+  /// Returns whether the deque appears empty to the caller.
+  bool empty() const noexcept {
+    return size() == 0;
+  }
+
+  /// Returns the capacity of the current buffer.
+  size_t capacity() const noexcept {
+    return buf_.load(std::memory_order_relaxed)->capacity();
+  }
+
+private:
+  class buffer {
+  public:
+    explicit buffer(size_t log_capacity)
+      : mask_((size_t{1} << log_capacity) - 1),
+        log_capacity_(log_capacity),
+        slots_(new std::atomic<pointer>[size_t{1} << log_capacity]) {
+      // nop
+    }
+
+    size_t capacity() const noexcept {
+      return mask_ + 1;
+    }
+
+    size_t log_capacity() const noexcept {
+      return log_capacity_;
+    }
+
+    pointer load(index_type pos) const noexcept {
+      return slots_[static_cast<size_t>(pos) & mask_].load(
+        std::memory_order_relaxed);
+    }
+
+    void store(index_type pos, pointer value) noexcept {
+      slots_[static_cast<size_t>(pos) & mask_].store(value,
+                                                     std::memory_order_relaxed);
+    }
+
+  private:
+    size_t mask_;
+    size_t log_capacity_;
+    std::unique_ptr<std::atomic<pointer>[]> slots_;
+  };
+
+  // Doubles the capacity of the buffer. Thieves may still read from the old
+  // buffer, hence we keep all retired buffers alive until destruction.
+  buffer* grow(buffer* old, index_type t, index_type b) {
+    auto buf = new buffer(old->log_capacity() + 1);
+    buffers_.emplace_back(buf);
+    for (auto i = t; i != b; ++i)
+      buf->store(i, old->load(i));
+    buf_.store(buf, std::memory_order_release);
+    return buf;
+  }
+
+  // Read by thieves, written by thieves and the owner.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<index_type> top_;
+
+  // Written by the owner only.
+  alignas(CAF_CACHE_LINE_SIZE) std::atomic<index_type> bottom_;
+
+  // Current buffer, replaced by the owner when growing.
+  std::atomic<buffer*> buf_;
+
+  // Owns all buffers ever allocated by this deque (accessed by owner only).
+  std::vector<std::unique_ptr<buffer>> buffers_;
+};
+
+} // namespace caf::detail
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 #include "caf/fwd.hpp"
 
 #include "caf/config.hpp"
@@ -61,9 +63,31 @@ public:
     proxies_ = ptr;
   }
 
+  /// Returns the scheduler pool owning this unit or `nullptr` if this unit
+  /// belongs to the default scheduler or runs outside of any scheduler.
+  scheduler::abstract_coordinator* pool() const noexcept {
+    return pool_;
+  }
+
+  /// Returns how long a resumable may run per call to `resume` in ticks of
+  /// `detail::tsc_clock` or 0 if only the maximum throughput limits it.
+  uint64_t resume_budget() const noexcept {
+    return resume_budget_;
+  }
+
+  /// Returns whether actors convert the resume budget into a message quota
+  /// based on their observed costs per message instead of reading the clock
+  /// after each message.
+  bool adaptive_resume_budget() const noexcept {
+    return adaptive_resume_budget_;
+  }
+
 protected:
   actor_system* system_ = nullptr;
   proxy_registry* proxies_ = nullptr;
+  scheduler::abstract_coordinator* pool_ = nullptr;
+  uint64_t resume_budget_ = 0;
+  bool adaptive_resume_budget_ = false;
 };
 
 } // namespace caf
@@ -251,6 +251,20 @@ class abstract_coordinator;
 
 } // namespace scheduler
 
+// -- telemetry classes --------------------------------------------------------
+
+namespace telemetry {
+
+class counter;
+class gauge;
+class histogram;
+class metric_registry;
+
+struct actor_metrics;
+struct worker_metrics;
+
+} // namespace telemetry
+
 // -- OpenSSL classes ----------------------------------------------------------
 
 namespace openssl {
@@ -213,6 +213,12 @@ public:
     return home_system().clock();
   }
 
+  /// Returns the metric instances for this actor or `nullptr` if the actor
+  /// does not collect metrics.
+  inline telemetry::actor_metrics* metrics() const noexcept {
+    return metrics_;
+  }
+
   /// @cond PRIVATE
 
   void monitor(abstract_actor* ptr, message_priority prio);
@@ -410,6 +416,10 @@ protected:
 
   /// Factory function for returning initial behavior in function-based actors.
   detail::unique_function<behavior(local_actor*)> initial_behavior_fac_;
+
+  /// Points to the metric instances for all actors with the same name if the
+  /// actor system collects metrics.
+  telemetry::actor_metrics* metrics_;
 };
 
 } // namespace caf
@@ -20,6 +20,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <new>
 
 #include "caf/actor_control_block.hpp"
 #include "caf/config.hpp"
@@ -76,6 +77,27 @@ public:
     return mid.category() == message_id::urgent_message_category;
   }
 
+#ifndef CAF_NO_MEM_MANAGEMENT
+  // -- memory management ------------------------------------------------------
+
+  /// Allocates memory for derived types from the @ref detail::slab_pool.
+  static void* operator new(size_t bytes);
+
+  static void* operator new(size_t, void* ptr) noexcept {
+    return ptr;
+  }
+
+  static void* operator new(size_t bytes, std::align_val_t alignment) {
+    return ::operator new(bytes, alignment);
+  }
+
+  static void operator delete(void* ptr) noexcept;
+
+  static void operator delete(void* ptr, std::align_val_t alignment) noexcept {
+    ::operator delete(ptr, alignment);
+  }
+#endif // CAF_NO_MEM_MANAGEMENT
+
   mailbox_element(mailbox_element&&) = delete;
   mailbox_element(const mailbox_element&) = delete;
   mailbox_element& operator=(mailbox_element&&) = delete;
@@ -21,6 +21,7 @@
 #include <tuple>
 #include <type_traits>
 
+#include "caf/atom.hpp"
 #include "caf/detail/apply_args.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/int_list.hpp"
@@ -43,6 +44,8 @@ public:
 
   match_case(uint32_t tt);
 
+  match_case(uint32_t tt, optional<atom_value> leading_atom);
+
   match_case(match_case&&) = default;
   match_case(const match_case&) = default;
 
@@ -57,8 +60,15 @@ public:
     return token_;
   }
 
+  /// Returns the atom constant that all matching messages start with or
+  /// `none` if this match case does not start with an atom constant.
+  const optional<atom_value>& leading_atom() const noexcept {
+    return leading_atom_;
+  }
+
 private:
   uint32_t token_;
+  optional<atom_value> leading_atom_;
 };
 
 template <bool IsVoid, class F>
@@ -124,7 +134,8 @@ public:
   trivial_match_case& operator=(const trivial_match_case&) = default;
 
   trivial_match_case(F f)
-    : match_case(make_type_token_from_list<pattern>()), fun_(std::move(f)) {
+    : match_case(make_type_token_from_list<pattern>(), make_leading_atom()),
+      fun_(std::move(f)) {
     // nop
   }
 
@@ -147,6 +158,14 @@ public:
 
 protected:
   F fun_;
+
+private:
+  static optional<atom_value> make_leading_atom() {
+    using trait = detail::leading_atom_constant<pattern>;
+    if (trait::valid)
+      return trait::value;
+    return none;
+  }
 };
 
 struct match_case_info {
@@ -86,6 +86,22 @@ public:
                           self->context(), std::forward<Ts>(xs)...);
   }
 
+  /// Sends `{xs...}` as an asynchronous message to all actors in `receivers`
+  /// with priority `P`. All receivers share a single message payload and the
+  /// scheduler receives all actors that become ready in one batch.
+  template <message_priority P = message_priority::normal, class Handles,
+            class... Ts>
+  void send_all(const Handles& receivers, Ts&&... xs) {
+    static_assert(sizeof...(Ts) > 0, "no message to send");
+    using dest_type = detail::decay_t<decltype(*std::begin(receivers))>;
+    detail::type_list<detail::strip_and_convert_t<Ts>...> args_token;
+    type_check<dest_type>(args_token);
+    auto self = dptr();
+    detail::profiled_send_all(self, self->ctrl(), receivers, make_message_id(P),
+                              self->context(),
+                              make_message(std::forward<Ts>(xs)...));
+  }
+
   template <message_priority P = message_priority::normal, class Dest = actor,
             class... Ts>
   void anon_send(const Dest& dest, Ts&&... xs) {
@@ -222,7 +238,12 @@ private:
   }
 
   template <class Dest, class ArgTypes>
-  static void type_check(const Dest&, ArgTypes) {
+  static void type_check(const Dest&, ArgTypes args_token) {
+    type_check<Dest>(args_token);
+  }
+
+  template <class Dest, class ArgTypes>
+  static void type_check(ArgTypes) {
     static_assert(!statically_typed<Subtype>() || statically_typed<Dest>(),
                   "statically typed actors are only allowed to send() to other "
                   "statically typed actors; use anon_send() or request() when "
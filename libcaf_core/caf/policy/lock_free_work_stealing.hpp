@@ -0,0 +1,149 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/detail/mpmc_ring_queue.hpp"
+#include "caf/detail/work_stealing_deque.hpp"
+#include "caf/policy/work_stealing.hpp"
+#include "caf/resumable.hpp"
+
+namespace caf::policy {
+
+/// Implements scheduling of actors via work stealing on top of lock-free data
+/// structures. Each worker owns a Chase-Lev deque for jobs it creates itself
+/// (owner pushes and pops at the bottom, thieves steal at the top) plus a
+/// lock-free inbox for jobs enqueued by other threads.
+/// @extends scheduler_policy
+class CAF_CORE_EXPORT lock_free_work_stealing : public work_stealing {
+public:
+  ~lock_free_work_stealing() override;
+
+  // A lock-free deque with a single owner and any number of thieves.
+  using queue_type = detail::work_stealing_deque<resumable>;
+
+  // A lock-free queue with any number of producers and consumers.
+  using inbox_type = detail::mpmc_ring_queue<resumable>;
+
+  // The owner checks its inbox before its deque every `inbox_poll_interval`
+  // jobs to make sure external jobs cannot starve.
+  static constexpr size_t inbox_poll_interval = 61;
+
+  // Holds job queues of a worker and a random number generator.
+  struct worker_data : worker_data_base {
+    explicit worker_data(scheduler::abstract_coordinator* p);
+    worker_data(const worker_data& other);
+
+    // Jobs enqueued by the worker itself. Other workers may steal from it.
+    queue_type queue;
+    // Jobs enqueued from other threads or re-scheduled by the worker.
+    inbox_type inbox;
+    // Counts dequeue operations for alternating between queue and inbox.
+    size_t ticks;
+  };
+
+  // Steals the oldest job of a victim, falling back to its inbox.
+  static resumable* steal_from(worker_data& victim) {
+    if (auto job = victim.queue.steal())
+      return job;
+    return victim.inbox.try_pop();
+  }
+
+  // Returns the approximate number of jobs waiting in the queues of `w`.
+  template <class Worker>
+  size_t backlog(Worker* w) {
+    return d(w).queue.size() + d(w).inbox.size();
+  }
+
+  template <class Worker>
+  resumable* try_steal(Worker* self) {
+    return raid(self, [](Worker* victim) { return steal_from(d(victim)); });
+  }
+
+  template <class Coordinator>
+  void central_enqueue(Coordinator* self, resumable* job) {
+    using worker_type = typename Coordinator::worker_type;
+    if (route(*this, self, static_cast<worker_type*>(nullptr), job))
+      return;
+    auto w = self->worker_by_id(d(self).next_worker++ % self->num_workers());
+    w->external_enqueue(job);
+  }
+
+  template <class Coordinator>
+  void central_enqueue_batch(Coordinator* self, span<resumable*> jobs) {
+    using worker_type = typename Coordinator::worker_type;
+    distribute(*this, self, jobs, [](worker_type* w, span<resumable*> chunk) {
+      for (auto job : chunk)
+        d(w).inbox.push(job);
+    });
+  }
+
+  template <class Worker>
+  void external_enqueue(Worker* self, resumable* job) {
+    d(self).inbox.push(job);
+    unpark(self);
+  }
+
+  template <class Worker>
+  void internal_enqueue(Worker* self, resumable* job) {
+    if (route(*this, self->parent(), self, job))
+      return;
+    d(self).queue.push(job);
+    unpark(self);
+  }
+
+  template <class Worker>
+  void resume_job_later(Worker* self, resumable* job) {
+    // job has voluntarily released the CPU to let others run instead, hence
+    // we put it into our FIFO inbox instead of the LIFO end of our deque
+    d(self).inbox.push(job);
+    unpark(self);
+  }
+
+  // Tries to get a job from the local queues of the worker.
+  template <class Worker>
+  resumable* try_dequeue(Worker* self) {
+    auto& wd = d(self);
+    if (auto job = wd.pinned.try_pop())
+      return job;
+    if (++wd.ticks % inbox_poll_interval == 0)
+      if (auto job = wd.inbox.try_pop())
+        return job;
+    if (auto job = wd.queue.take())
+      return job;
+    return wd.inbox.try_pop();
+  }
+
+  template <class Worker>
+  resumable* dequeue(Worker* self) {
+    return poll_or_park(*this, self,
+                        [](Worker* victim) { return steal_from(d(victim)); });
+  }
+
+  template <class Worker, class UnaryFunction>
+  void foreach_resumable(Worker* self, UnaryFunction f) {
+    auto next = [&] { return try_dequeue(self); };
+    for (auto job = next(); job != nullptr; job = next())
+      f(job);
+  }
+};
+
+} // namespace caf::policy
@@ -21,6 +21,7 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
+#include "caf/span.hpp"
 
 namespace caf::policy {
 
@@ -42,6 +43,11 @@ public:
   template <class Coordinator>
   void central_enqueue(Coordinator* self, resumable* job);
 
+  /// Enqueues all `jobs` to the coordinator. Implementations should acquire
+  /// each lock and wake up each worker at most once.
+  template <class Coordinator>
+  void central_enqueue_batch(Coordinator* self, span<resumable*> jobs);
+
   /// Enqueues a new job to the worker's queue from an
   /// external source, i.e., from any other thread.
   template <class Worker>
@@ -19,6 +19,7 @@
 #pragma once
 
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/cpu_topology.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
 
 namespace caf::policy {
@@ -32,6 +33,13 @@ class CAF_CORE_EXPORT unprofiled {
 public:
   virtual ~unprofiled();
 
+  /// Configures the workers of a coordinator according to the CPU topology
+  /// before the workers start. Only called in NUMA-aware mode.
+  template <class Coordinator>
+  void init_placement(Coordinator*, const detail::worker_placement&) {
+    // nop
+  }
+
   /// Performs cleanup action before a shutdown takes place.
   template <class Worker>
   void before_shutdown(Worker*) {
@@ -18,14 +18,15 @@
 
 #pragma once
 
-#include <condition_variable>
+#include <chrono>
 #include <cstddef>
-#include <list>
-#include <mutex>
 
 #include "caf/detail/core_export.hpp"
+#include "caf/detail/mpmc_ring_queue.hpp"
+#include "caf/detail/parking_lot.hpp"
 #include "caf/policy/unprofiled.hpp"
 #include "caf/resumable.hpp"
+#include "caf/span.hpp"
 
 namespace caf::policy {
 
@@ -33,19 +34,25 @@ namespace caf::policy {
 /// @extends scheduler_policy
 class CAF_CORE_EXPORT work_sharing : public unprofiled {
 public:
-  // A thread-safe queue implementation.
-  using queue_type = std::list<resumable*>;
+  // A lock-free queue with any number of producers and consumers. Falls back
+  // to a mutex-guarded overflow list only if the ring runs full.
+  using queue_type = detail::mpmc_ring_queue<resumable>;
+
+  // Capacity of the lock-free ring, i.e., 4096 jobs.
+  static constexpr size_t log_queue_capacity = 12;
 
   ~work_sharing() override;
 
+  // The coordinator has the central job queue and a parking lot for idle
+  // workers.
   struct coordinator_data {
-    inline explicit coordinator_data(scheduler::abstract_coordinator*) {
+    inline explicit coordinator_data(scheduler::abstract_coordinator*)
+      : queue(log_queue_capacity) {
       // nop
     }
 
     queue_type queue;
-    std::mutex lock;
-    std::condition_variable cv;
+    detail::parking_lot lot;
   };
 
   struct worker_data {
@@ -56,11 +63,8 @@ public:
 
   template <class Coordinator>
   void enqueue(Coordinator* self, resumable* job) {
-    queue_type l;
-    l.push_back(job);
-    std::unique_lock<std::mutex> guard(d(self).lock);
-    d(self).queue.splice(d(self).queue.end(), l);
-    d(self).cv.notify_one();
+    d(self).queue.push(job);
+    d(self).lot.unpark_one();
   }
 
   template <class Coordinator>
@@ -68,6 +72,21 @@ public:
     enqueue(self, job);
   }
 
+  template <class Coordinator>
+  void central_enqueue_batch(Coordinator* self, span<resumable*> jobs) {
+    if (jobs.empty())
+      return;
+    auto& data = d(self);
+    for (auto job : jobs)
+      data.queue.push(job);
+    if (jobs.size() < self->num_workers()) {
+      for (size_t i = 0; i < jobs.size(); ++i)
+        data.lot.unpark_one();
+    } else {
+      data.lot.unpark_all();
+    }
+  }
+
   template <class Worker>
   void external_enqueue(Worker* self, resumable* job) {
     enqueue(self->parent(), job);
@@ -88,11 +107,28 @@ public:
   template <class Worker>
   resumable* dequeue(Worker* self) {
     auto& parent_data = d(self->parent());
-    std::unique_lock<std::mutex> guard(parent_data.lock);
-    parent_data.cv.wait(guard, [&] { return !parent_data.queue.empty(); });
-    resumable* job = parent_data.queue.front();
-    parent_data.queue.pop_front();
-    return job;
+    auto& queue = parent_data.queue;
+    auto& lot = parent_data.lot;
+    for (;;) {
+      if (auto job = queue.try_pop())
+        return job;
+      // we need to re-check the queue after announcing that we are about to
+      // park to make sure we cannot miss a wakeup
+      auto key = lot.prepare_park();
+      if (auto job = queue.try_pop()) {
+        lot.cancel_park();
+        return job;
+      }
+      if (auto park_time = self->metrics().park_time) {
+        using clock_type = std::chrono::steady_clock;
+        auto t0 = clock_type::now();
+        lot.park(key);
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        park_time->observe(dt.count());
+      } else {
+        lot.park(key);
+      }
+    }
   }
 
   template <class Worker, class UnaryFunction>
@@ -103,18 +139,8 @@ public:
   template <class Coordinator, class UnaryFunction>
   void foreach_central_resumable(Coordinator* self, UnaryFunction f) {
     auto& queue = d(self).queue;
-    auto next = [&]() -> resumable* {
-      if (queue.empty()) {
-        return nullptr;
-      }
-      auto front = queue.front();
-      queue.pop_front();
-      return front;
-    };
-    std::unique_lock<std::mutex> guard(d(self).lock);
-    for (auto job = next(); job != nullptr; job = next()) {
+    for (auto job = queue.try_pop(); job != nullptr; job = queue.try_pop())
       f(job);
-    }
   }
 };
 
@@ -18,21 +18,25 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
-#include <condition_variable>
 #include <cstddef>
 #include <deque>
-#include <mutex>
 #include <random>
-#include <thread>
+#include <vector>
 
+#include "caf/actor_config.hpp"
 #include "caf/actor_system_config.hpp"
 #include "caf/detail/core_export.hpp"
 #include "caf/detail/double_ended_queue.hpp"
+#include "caf/detail/mpmc_ring_queue.hpp"
+#include "caf/detail/parking_lot.hpp"
+#include "caf/detail/scheduling_hints.hpp"
 #include "caf/policy/unprofiled.hpp"
 #include "caf/resumable.hpp"
-#include "caf/timespan.hpp"
+#include "caf/span.hpp"
 
 namespace caf::policy {
 
@@ -45,84 +49,253 @@ public:
   // A thread-safe queue implementation.
   using queue_type = detail::double_ended_queue<resumable>;
 
-  // configuration for aggressive/moderate/relaxed poll strategies.
+  // Pinned actors are rare, so we use a small ring for them.
+  static constexpr size_t pinned_log_capacity = 6;
+
+  // configuration for polling before a worker parks.
   struct poll_strategy {
     size_t attempts;
-    size_t step_size;
     size_t steal_interval;
-    timespan sleep_duration;
-  };
-
-  // what is needed to implement the waiting strategy.
-  struct wait_strategy {
-    std::mutex lock;
-    std::condition_variable cv;
-    bool sleeping{false};
   };
 
-  // The coordinator has only a counter for round-robin enqueue to its workers.
+  // The coordinator has a counter for round-robin enqueue to its workers,
+  // counts parked workers and stores the settings for sticky scheduling.
   struct coordinator_data {
-    inline explicit coordinator_data(scheduler::abstract_coordinator*)
-      : next_worker(0) {
-      // nop
-    }
+    explicit coordinator_data(scheduler::abstract_coordinator* p);
 
     std::atomic<size_t> next_worker;
+    // number of workers that are parked or about to park
+    std::atomic<size_t> num_parked;
+    // routes re-activated actors back to the worker that ran them last
+    bool sticky;
+    // maximum backlog of a worker before sticky scheduling picks another one
+    size_t max_backlog;
+  };
+
+  // Holds the state that all work-stealing policies share per worker.
+  struct worker_data_base {
+    explicit worker_data_base(scheduler::abstract_coordinator* p);
+    worker_data_base(const worker_data_base& other);
+
+    // needed to generate pseudo random numbers
+    std::default_random_engine rengine;
+    std::uniform_int_distribution<size_t> uniform;
+    poll_strategy polling;
+    // victims grouped by distance, empty unless running in NUMA-aware mode
+    std::vector<std::vector<size_t>> steal_tiers;
+    // jobs pinned to this worker, never stolen by other workers
+    detail::mpmc_ring_queue<resumable> pinned;
+    // allows producers to wake up this particular worker
+    detail::parking_lot lot;
   };
 
   // Holds job job queue of a worker and a random number generator.
-  struct worker_data {
+  struct worker_data : worker_data_base {
     explicit worker_data(scheduler::abstract_coordinator* p);
     worker_data(const worker_data& other);
 
     // This queue is exposed to other workers that may attempt to steal jobs
     // from it and the central scheduling unit can push new jobs to the queue.
     queue_type queue;
-    // needed to generate pseudo random numbers
-    std::default_random_engine rengine;
-    std::uniform_int_distribution<size_t> uniform;
-    std::array<poll_strategy, 3> strategies;
-    wait_strategy waitdata;
+    // approximates the size of `queue`, only maintained in sticky mode
+    std::atomic<size_t> backlog;
   };
 
-  // Goes on a raid in quest for a shiny new job.
-  template <class Worker>
-  resumable* try_steal(Worker* self) {
+  /// Reads the poll strategy from the config.
+  static poll_strategy make_poll_strategy(scheduler::abstract_coordinator* p);
+
+  // Calls `steal_from` on potential victims until it returns a job. Picks a
+  // random victim in default mode. In NUMA-aware mode, tries one random
+  // victim per tier, starting with the workers closest to `self`.
+  template <class Worker, class F>
+  resumable* raid(Worker* self, F steal_from) {
     auto p = self->parent();
     if (p->num_workers() < 2) {
       // you can't steal from yourself, can you?
       return nullptr;
     }
-    // roll the dice to pick a victim other than ourselves
-    auto victim = d(self).uniform(d(self).rengine);
-    if (victim == self->id())
-      victim = p->num_workers() - 1;
+    auto& wd = d(self);
+    if (wd.steal_tiers.empty()) {
+      // roll the dice to pick a victim other than ourselves
+      auto victim = wd.uniform(wd.rengine);
+      if (victim == self->id())
+        victim = p->num_workers() - 1;
+      return count_steal(self, steal_from(p->worker_by_id(victim)));
+    }
+    for (auto& tier : wd.steal_tiers) {
+      if (tier.empty())
+        continue;
+      auto victim = tier[wd.rengine() % tier.size()];
+      if (auto job = steal_from(p->worker_by_id(victim)))
+        return count_steal(self, job);
+    }
+    return nullptr;
+  }
+
+  // Updates the steal counter of `self` if `job` is not `nullptr`.
+  template <class Worker>
+  static resumable* count_steal(Worker* self, resumable* job) {
+    if (job != nullptr)
+      if (auto steals = self->metrics().steals)
+        steals->inc();
+    return job;
+  }
+
+  // Takes a job from the queue of `w` and updates the backlog counter.
+  template <class Worker>
+  resumable* take(Worker* w, bool from_head) {
+    auto& wd = d(w);
+    auto job = from_head ? wd.queue.take_head() : wd.queue.take_tail();
+    if (job != nullptr && d(w->parent()).sticky)
+      wd.backlog.fetch_sub(1, std::memory_order_relaxed);
+    return job;
+  }
+
+  // Returns the approximate number of jobs waiting in the queue of `w`.
+  template <class Worker>
+  size_t backlog(Worker* w) {
+    return d(w).backlog.load(std::memory_order_relaxed);
+  }
+
+  // Goes on a raid in quest for a shiny new job.
+  template <class Worker>
+  resumable* try_steal(Worker* self) {
     // steal oldest element from the victim's queue
-    return d(p->worker_by_id(victim)).queue.take_tail();
+    return raid(self, [this](Worker* victim) { return take(victim, false); });
+  }
+
+  template <class Coordinator>
+  void init_placement(Coordinator* self,
+                      const detail::worker_placement& placement) {
+    for (size_t i = 0; i < self->num_workers(); ++i)
+      d(self->worker_by_id(i)).steal_tiers = placement.steal_tiers[i];
+  }
+
+  // Checks the local queues of `self` and then calls `steal_from` on all
+  // other workers until it returns a job. Idle workers must sweep all queues
+  // before parking.
+  template <class Policy, class Worker, class F>
+  static resumable* sweep(Policy& policy, Worker* self, F steal_from) {
+    if (auto job = policy.try_dequeue(self))
+      return job;
+    auto p = self->parent();
+    auto n = p->num_workers();
+    for (size_t i = 1; i < n; ++i)
+      if (auto job = steal_from(p->worker_by_id((self->id() + i) % n)))
+        return count_steal(self, job);
+    return nullptr;
+  }
+
+  // Wakes up one parked worker, if any, to pick up a new job. Checks `self`
+  // first and then the other workers in order.
+  template <class Worker>
+  static void unpark(Worker* self) {
+    auto p = self->parent();
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (d(p).num_parked.load(std::memory_order_relaxed) == 0)
+      return;
+    auto n = p->num_workers();
+    for (size_t i = 0; i < n; ++i) {
+      auto& lot = d(p->worker_by_id((self->id() + i) % n)).lot;
+      if (lot.num_waiters() != 0) {
+        lot.unpark_one();
+        return;
+      }
+    }
+  }
+
+  // Enqueues `job` to the worker it has an affinity to. Returns `false` if
+  // `job` has no affinity or if sticky scheduling decided against it, in
+  // which case the caller picks a worker. The parameter `self` points to the
+  // calling worker or is `nullptr` if the caller is no worker.
+  template <class Policy, class Coordinator, class Worker>
+  static bool route(Policy& policy, Coordinator* p, Worker* self,
+                    resumable* job) {
+    auto id = detail::pinned_worker(job);
+    if (id != actor_config::no_worker) {
+      // actors validate their pinned worker, hence `id` is always in range
+      CAF_ASSERT(id < p->num_workers());
+      auto& wd = d(p->worker_by_id(id));
+      wd.pinned.push(job);
+      // only the target worker can run pinned jobs
+      wd.lot.unpark_one();
+      return true;
+    }
+    if (!d(p).sticky)
+      return false;
+    id = detail::last_worker(job);
+    if (id >= p->num_workers() || (self != nullptr && self->id() == id))
+      return false;
+    auto w = p->worker_by_id(id);
+    if (policy.backlog(w) >= d(p).max_backlog)
+      return false;
+    w->external_enqueue(job);
+    return true;
   }
 
   template <class Coordinator>
   void central_enqueue(Coordinator* self, resumable* job) {
+    using worker_type = typename Coordinator::worker_type;
+    if (route(*this, self, static_cast<worker_type*>(nullptr), job))
+      return;
     auto w = self->worker_by_id(d(self).next_worker++ % self->num_workers());
     w->external_enqueue(job);
   }
 
+  // Distributes `jobs` in contiguous chunks over the workers, starting at the
+  // next round-robin position, and wakes up one parked worker per chunk. Jobs
+  // with an affinity go to their worker via `route` instead. Calls
+  // `push(worker, chunk)` once per worker that receives a chunk.
+  template <class Policy, class Coordinator, class F>
+  static void distribute(Policy& policy, Coordinator* self,
+                         span<resumable*> jobs, F push) {
+    using worker_type = typename Coordinator::worker_type;
+    size_t n = 0;
+    for (auto job : jobs)
+      if (!route(policy, self, static_cast<worker_type*>(nullptr), job))
+        jobs[n++] = job;
+    if (n == 0)
+      return;
+    auto num_workers = self->num_workers();
+    auto num_chunks = std::min(n, num_workers);
+    auto offset = d(self).next_worker.fetch_add(num_chunks);
+    size_t pos = 0;
+    for (size_t i = 0; i < num_chunks; ++i) {
+      auto chunk_size = n / num_chunks + (i < n % num_chunks ? 1 : 0);
+      push(self->worker_by_id((offset + i) % num_workers),
+           jobs.subspan(pos, chunk_size));
+      pos += chunk_size;
+    }
+    for (size_t i = 0; i < num_chunks; ++i)
+      unpark(self->worker_by_id((offset + i) % num_workers));
+  }
+
+  template <class Coordinator>
+  void central_enqueue_batch(Coordinator* self, span<resumable*> jobs) {
+    using worker_type = typename Coordinator::worker_type;
+    distribute(*this, self, jobs, [](worker_type* w, span<resumable*> chunk) {
+      d(w).queue.append(chunk.begin(), chunk.end());
+      if (d(w->parent()).sticky)
+        d(w).backlog.fetch_add(chunk.size(), std::memory_order_relaxed);
+    });
+  }
+
   template <class Worker>
   void external_enqueue(Worker* self, resumable* job) {
     d(self).queue.append(job);
-    auto& lock = d(self).waitdata.lock;
-    auto& cv = d(self).waitdata.cv;
-    { // guard scope
-      std::unique_lock<std::mutex> guard(lock);
-      // check if the worker is sleeping
-      if (d(self).waitdata.sleeping && !d(self).queue.empty())
-        cv.notify_one();
-    }
+    if (d(self->parent()).sticky)
+      d(self).backlog.fetch_add(1, std::memory_order_relaxed);
+    unpark(self);
   }
 
   template <class Worker>
   void internal_enqueue(Worker* self, resumable* job) {
+    if (route(*this, self->parent(), self, job))
+      return;
     d(self).queue.prepend(job);
+    if (d(self->parent()).sticky)
+      d(self).backlog.fetch_add(1, std::memory_order_relaxed);
+    unpark(self);
   }
 
   template <class Worker>
@@ -130,76 +303,77 @@ public:
     // job has voluntarily released the CPU to let others run instead
     // this means we are going to put this job to the very end of our queue
     d(self).queue.append(job);
+    if (d(self->parent()).sticky)
+      d(self).backlog.fetch_add(1, std::memory_order_relaxed);
+    unpark(self);
   }
 
+  // Remembers which worker runs an actor for sticky scheduling.
   template <class Worker>
-  resumable* dequeue(Worker* self) {
-    // we wait for new jobs by polling our external queue: first, we
-    // assume an active work load on the machine and perform aggressive
-    // polling, then we relax our polling a bit and wait 50 us between
-    // dequeue attempts
-    auto& strategies = d(self).strategies;
-    resumable* job = nullptr;
-    for (size_t k = 0; k < 2; ++k) { // iterate over the first two strategies
-      for (size_t i = 0; i < strategies[k].attempts;
-           i += strategies[k].step_size) {
-        job = d(self).queue.take_head();
-        if (job)
+  void before_resume(Worker* self, resumable* job) {
+    if (d(self->parent()).sticky)
+      detail::last_worker(job, self->id());
+  }
+
+  // Polls for new jobs and parks the worker if there is nothing to do. Other
+  // policies reuse this algorithm by providing their own `try_dequeue`,
+  // `try_steal` and `steal_from` implementations.
+  template <class Policy, class Worker, class F>
+  static resumable* poll_or_park(Policy& policy, Worker* self, F steal_from) {
+    // we assume an active work load on the machine and poll aggressively
+    // before giving up the CPU
+    auto& polling = d(self).polling;
+    for (size_t i = 0; i < polling.attempts; ++i) {
+      if (auto job = policy.try_dequeue(self))
+        return job;
+      // try to steal every X poll attempts
+      if ((i % polling.steal_interval) == 0)
+        if (auto job = policy.try_steal(self))
           return job;
-        // try to steal every X poll attempts
-        if ((i % strategies[k].steal_interval) == 0) {
-          job = try_steal(self);
-          if (job)
-            return job;
-        }
-        if (strategies[k].sleep_duration.count() > 0) {
-#ifdef CAF_MSVC
-          // Windows cannot sleep less than 1000 us, so timeout is converted to
-          // 0 inside sleep_for(), but Sleep(0) is dangerous so replace it with
-          // yield()
-          if (strategies[k].sleep_duration.count() < 1000)
-            std::this_thread::yield();
-          else
-            std::this_thread::sleep_for(strategies[k].sleep_duration);
-#else
-          std::this_thread::sleep_for(strategies[k].sleep_duration);
-#endif
-        }
-      }
     }
-    // we assume pretty much nothing is going on so we can relax polling
-    // and falling to sleep on a condition variable whose timeout is the one
-    // of the relaxed polling strategy
-    auto& relaxed = strategies[2];
-    auto& sleeping = d(self).waitdata.sleeping;
-    auto& lock = d(self).waitdata.lock;
-    auto& cv = d(self).waitdata.cv;
-    bool notimeout = true;
-    size_t i = 1;
-    do {
-      { // guard scope
-        std::unique_lock<std::mutex> guard(lock);
-        sleeping = true;
-        if (!cv.wait_for(guard, relaxed.sleep_duration,
-                         [&] { return !d(self).queue.empty(); }))
-          notimeout = false;
-        sleeping = false;
+    // we need to re-check all queues after announcing that we are about to
+    // park to make sure we cannot miss a wakeup
+    auto& num_parked = d(self->parent()).num_parked;
+    auto& lot = d(self).lot;
+    for (;;) {
+      num_parked.fetch_add(1, std::memory_order_relaxed);
+      auto key = lot.prepare_park();
+      if (auto job = sweep(policy, self, steal_from)) {
+        lot.cancel_park();
+        num_parked.fetch_sub(1, std::memory_order_relaxed);
+        return job;
       }
-      if (notimeout) {
-        job = d(self).queue.take_head();
+      if (auto park_time = self->metrics().park_time) {
+        using clock_type = std::chrono::steady_clock;
+        auto t0 = clock_type::now();
+        lot.park(key);
+        std::chrono::duration<double> dt = clock_type::now() - t0;
+        park_time->observe(dt.count());
       } else {
-        notimeout = true;
-        if ((i % relaxed.steal_interval) == 0)
-          job = try_steal(self);
+        lot.park(key);
       }
-      ++i;
-    } while (job == nullptr);
-    return job;
+      num_parked.fetch_sub(1, std::memory_order_relaxed);
+      if (auto job = sweep(policy, self, steal_from))
+        return job;
+    }
+  }
+
+  template <class Worker>
+  resumable* try_dequeue(Worker* self) {
+    if (auto job = d(self).pinned.try_pop())
+      return job;
+    return take(self, true);
+  }
+
+  template <class Worker>
+  resumable* dequeue(Worker* self) {
+    return poll_or_park(*this, self,
+                        [this](Worker* victim) { return take(victim, false); });
   }
 
   template <class Worker, class UnaryFunction>
   void foreach_resumable(Worker* self, UnaryFunction f) {
-    auto next = [&] { return d(self).queue.take_head(); };
+    auto next = [&] { return try_dequeue(self); };
     for (auto job = next(); job != nullptr; job = next()) {
       f(job);
     }
@@ -24,6 +24,7 @@
 #  include <exception>
 #endif // CAF_NO_EXCEPTIONS
 
+#include <atomic>
 #include <forward_list>
 #include <map>
 #include <type_traits>
@@ -41,6 +42,7 @@
 #include "caf/detail/stream_stage_driver_impl.hpp"
 #include "caf/detail/stream_stage_impl.hpp"
 #include "caf/detail/tick_emitter.hpp"
+#include "caf/detail/tsc_clock.hpp"
 #include "caf/detail/unordered_flat_map.hpp"
 #include "caf/error.hpp"
 #include "caf/extend.hpp"
@@ -76,6 +78,7 @@
 #include "caf/stream_sink_trait.hpp"
 #include "caf/stream_source_trait.hpp"
 #include "caf/stream_stage_trait.hpp"
+#include "caf/telemetry/actor_metrics.hpp"
 #include "caf/to_string.hpp"
 
 namespace caf {
@@ -213,6 +216,20 @@ public:
     scheduled_actor* self;
     size_t& handled_msgs;
     size_t max_throughput;
+    /// Point in time in ticks of `detail::tsc_clock` after which the actor
+    /// yields or 0 if only `max_throughput` limits the current run.
+    uint64_t deadline;
+
+    /// Returns whether the actor exceeded the time budget of this run.
+    bool out_of_time() const noexcept {
+      return deadline != 0 && detail::tsc_clock::now() >= deadline;
+    }
+
+    /// Counts a consumed message and returns whether the actor may consume
+    /// another one in this run.
+    bool consumed() noexcept {
+      return ++handled_msgs < max_throughput && !out_of_time();
+    }
 
     /// Consumes upstream messages.
     intrusive::task_result
@@ -331,6 +348,39 @@ public:
     return pending_stream_managers_;
   }
 
+  // -- scheduler hints --------------------------------------------------------
+
+  /// Returns the ID of the worker that ran this actor most recently or
+  /// `actor_config::no_worker`. Only updated by schedulers with sticky
+  /// scheduling enabled.
+  inline size_t last_worker() const noexcept {
+    return last_worker_.load(std::memory_order_relaxed);
+  }
+
+  /// Sets the ID of the worker that ran this actor most recently.
+  inline void last_worker(size_t id) noexcept {
+    last_worker_.store(id, std::memory_order_relaxed);
+  }
+
+  /// Returns the ID of the worker this actor is pinned to or
+  /// `actor_config::no_worker`.
+  inline size_t pinned_worker() const noexcept {
+    return pinned_worker_.load(std::memory_order_relaxed);
+  }
+
+  /// Pins this actor to the worker with ID `id`, i.e., causes work-stealing
+  /// schedulers to always run this actor on that worker. Passing
+  /// `actor_config::no_worker` releases the actor again.
+  /// @returns `false` if `id` does not refer to a worker of the scheduler
+  ///          that runs this actor, in which case the pinning is unchanged.
+  bool pin_to_worker(size_t id) noexcept;
+
+  /// Returns the scheduler pool of this actor or `nullptr` if the actor runs
+  /// in the default scheduler.
+  inline scheduler::abstract_coordinator* pool() const noexcept {
+    return pool_;
+  }
+
   // -- event handlers ---------------------------------------------------------
 
   /// Sets a custom handler for unexpected messages.
@@ -844,6 +894,24 @@ public:
   /// this function again.
   actor_clock::time_point advance_streams(actor_clock::time_point now);
 
+  // -- scheduling -------------------------------------------------------------
+
+  /// Hands this actor to `eu` if `eu` belongs to the actor's scheduler pool
+  /// and to the pool itself otherwise.
+  /// @private
+  void schedule(execution_unit* eu);
+
+  // -- metrics ----------------------------------------------------------------
+
+  /// Updates the metrics after adding a message to the mailbox.
+  /// @private
+  inline void count_received() noexcept {
+    if (metrics_ != nullptr) {
+      metrics_->received->inc();
+      metrics_->mailbox_size->inc();
+    }
+  }
+
   // -- properties -------------------------------------------------------------
 
   /// Returns `true` if the actor has a behavior, awaits responses, or
@@ -906,6 +974,21 @@ protected:
   /// Pointer to a private thread object associated with a detached actor.
   detail::private_thread* private_thread_;
 
+  /// Stores the ID of the worker that ran this actor most recently.
+  std::atomic<size_t> last_worker_;
+
+  /// Smoothed cost of consuming a single message in ticks of
+  /// `detail::tsc_clock` or 0 if unknown. Only maintained for execution units
+  /// with an adaptive resume budget.
+  uint64_t msg_cost_;
+
+  /// Stores the ID of the worker this actor is pinned to.
+  std::atomic<size_t> pinned_worker_;
+
+  /// Points to the scheduler pool of this actor or `nullptr` for the default
+  /// scheduler.
+  scheduler::abstract_coordinator* pool_;
+
 #ifndef CAF_NO_EXCEPTIONS
   /// Customization point for setting a default exception callback.
   exception_handler exception_handler_;
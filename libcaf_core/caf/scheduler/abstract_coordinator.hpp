@@ -21,6 +21,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <string>
 
 #include "caf/actor.hpp"
 #include "caf/actor_addr.hpp"
@@ -31,6 +32,8 @@
 #include "caf/detail/core_export.hpp"
 #include "caf/fwd.hpp"
 #include "caf/message.hpp"
+#include "caf/span.hpp"
+#include "caf/timespan.hpp"
 
 namespace caf::scheduler {
 
@@ -57,6 +60,13 @@ public:
   /// Puts `what` into the queue of a randomly chosen worker.
   virtual void enqueue(resumable* what) = 0;
 
+  /// Puts all `jobs` into the queues of the workers. Schedulers override this
+  /// function to distribute the jobs with fewer synchronization steps than
+  /// calling `enqueue` for each job. The default implementation calls
+  /// `enqueue` for each job.
+  /// @note Implementations may reorder the elements of `jobs`.
+  virtual void enqueue_batch(span<resumable*> jobs);
+
   inline actor_system& system() {
     return system_;
   }
@@ -67,13 +77,54 @@ public:
     return max_throughput_;
   }
 
+  /// Returns how long actors may run per resume or 0 if only
+  /// `max_throughput` limits a single resume.
+  inline timespan max_resume_time() const {
+    return max_resume_time_;
+  }
+
+  /// Returns whether actors convert `max_resume_time` into a message quota
+  /// based on their observed costs per message.
+  inline bool adaptive_resume_time() const {
+    return adaptive_resume_time_;
+  }
+
   inline size_t num_workers() const {
     return num_workers_;
   }
 
+  /// Returns whether workers get pinned to individual CPUs.
+  inline bool pin_workers() const {
+    return pin_workers_;
+  }
+
+  /// Returns whether workers steal from nearby workers first.
+  inline bool numa_aware() const {
+    return numa_aware_;
+  }
+
   /// Returns `true` if this scheduler detaches its utility actors.
   virtual bool detaches_utility_actors() const;
 
+  /// Returns the name of this scheduler pool or an empty string for the
+  /// default scheduler of the actor system.
+  inline const std::string& pool_name() const noexcept {
+    return pool_name_;
+  }
+
+  /// Returns whether this instance is an additional scheduler pool, i.e., not
+  /// the default scheduler of the actor system.
+  inline bool is_pool() const noexcept {
+    return !pool_name_.empty();
+  }
+
+  /// Turns this instance into a named scheduler pool. Pools read their
+  /// configuration from `scheduler.pools.<name>`, fall back to `scheduler.*`
+  /// for missing options, and neither run utility actors nor a clock.
+  /// @pre `init` has not been called yet
+  /// @private
+  void pool_name(std::string name);
+
   void start() override;
 
   void init(actor_system_config& cfg) override;
@@ -95,9 +146,30 @@ protected:
   /// Number of messages each actor is allowed to consume per resume.
   size_t max_throughput_;
 
+  /// Time each actor is allowed to run per resume, 0 disables the limit.
+  timespan max_resume_time_;
+
+  /// Configures whether actors derive message quotas from their costs.
+  bool adaptive_resume_time_;
+
   /// Configured number of workers.
   size_t num_workers_;
 
+  /// Configures whether workers get pinned to individual CPUs.
+  bool pin_workers_;
+
+  /// Configures whether workers steal hierarchically based on CPU topology.
+  bool numa_aware_;
+
+  /// Selects the implementation of the system-wide clock.
+  atom_value clock_type_;
+
+  /// Configures the tick length of the timing wheel clock.
+  timespan clock_resolution_;
+
+  /// Name of this pool or empty for the default scheduler.
+  std::string pool_name_;
+
   /// Background workers, e.g., printer.
   std::array<actor, max_id> utility_actors_;
 
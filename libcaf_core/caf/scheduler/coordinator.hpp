@@ -25,8 +25,10 @@
 #include <memory>
 #include <thread>
 
+#include "caf/detail/cpu_topology.hpp"
 #include "caf/detail/set_thread_name.hpp"
 #include "caf/detail/thread_safe_actor_clock.hpp"
+#include "caf/detail/timer_wheel_actor_clock.hpp"
 #include "caf/scheduler/abstract_coordinator.hpp"
 #include "caf/scheduler/worker.hpp"
 
@@ -54,6 +56,12 @@ public:
     return data_;
   }
 
+  /// Returns the CPU assignment and steal order of all workers. Empty unless
+  /// `scheduler.affinity` or `scheduler.numa-aware` is enabled.
+  const detail::worker_placement& placement() const noexcept {
+    return placement_;
+  }
+
   static actor_system::module* make(actor_system& sys, detail::type_list<>) {
     return new coordinator(sys);
   }
@@ -68,16 +76,43 @@ protected:
     // Create worker instanes.
     for (size_t i = 0; i < num; ++i)
       workers_.emplace_back(new worker_type(i, this, init, max_throughput_));
+    // Map workers to CPUs if the user enabled topology-aware scheduling.
+    if (pin_workers_ || numa_aware_)
+      placement_ = detail::cpu_topology::detect().place(num);
+    if (numa_aware_)
+      policy_.init_placement(this, placement_);
     // Start all workers.
     for (auto& w : workers_)
       w->start();
+    if (pin_workers_) {
+      for (size_t i = 0; i < num; ++i) {
+        auto cpu = placement_.cpus[i].id;
+        if (!detail::set_thread_affinity(workers_[i]->get_thread(), cpu))
+          CAF_LOG_WARNING("unable to pin worker:" << CAF_ARG(i)
+                                                  << CAF_ARG(cpu));
+      }
+    }
     // Launch an additional background thread for dispatching timeouts and
-    // delayed messages.
+    // delayed messages. The timing wheel uses one shard per worker. Pools
+    // share the clock of the default scheduler.
+    if (is_pool()) {
+      super::start();
+      return;
+    }
+    if (clock_type_ == atom("wheel")) {
+      wheel_.reset(new detail::timer_wheel_actor_clock(num, clock_resolution_));
+    } else if (clock_type_ != atom("simple")) {
+      CAF_LOG_WARNING("unknown clock type, fall back to 'simple':"
+                      << CAF_ARG(clock_type_));
+    }
     timer_ = std::thread{[&] {
       CAF_SET_LOGGER_SYS(&system());
       detail::set_thread_name("caf.clock");
       system().thread_started();
-      clock_.run_dispatch_loop();
+      if (wheel_)
+        wheel_->run_dispatch_loop();
+      else
+        clock_.run_dispatch_loop();
       system().thread_terminates();
     }};
     // Run remaining startup code.
@@ -140,7 +175,12 @@ protected:
       policy_.foreach_resumable(w.get(), f);
     policy_.foreach_central_resumable(this, f);
     // stop timer thread
-    clock_.cancel_dispatch_loop();
+    if (is_pool())
+      return;
+    if (wheel_)
+      wheel_->cancel_dispatch_loop();
+    else
+      clock_.cancel_dispatch_loop();
     timer_.join();
   }
 
@@ -148,7 +188,15 @@ protected:
     policy_.central_enqueue(this, ptr);
   }
 
-  detail::thread_safe_actor_clock& clock() noexcept override {
+  void enqueue_batch(span<resumable*> jobs) override {
+    policy_.central_enqueue_batch(this, jobs);
+  }
+
+  actor_clock& clock() noexcept override {
+    if (is_pool())
+      return system().scheduler().clock();
+    if (wheel_)
+      return *wheel_;
     return clock_;
   }
 
@@ -156,9 +204,15 @@ private:
   /// System-wide clock.
   detail::thread_safe_actor_clock clock_;
 
+  /// System-wide clock if `scheduler.clock` is set to `wheel`.
+  std::unique_ptr<detail::timer_wheel_actor_clock> wheel_;
+
   /// Set of workers.
   std::vector<std::unique_ptr<worker_type>> workers_;
 
+  /// CPU assignment and steal order of all workers.
+  detail::worker_placement placement_;
+
   /// Policy-specific data.
   policy_data data_;
 
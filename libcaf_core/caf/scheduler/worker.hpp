@@ -18,13 +18,18 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 
 #include "caf/detail/double_ended_queue.hpp"
 #include "caf/detail/set_thread_name.hpp"
+#include "caf/detail/tsc_clock.hpp"
+#include "caf/actor_system.hpp"
 #include "caf/execution_unit.hpp"
 #include "caf/logger.hpp"
 #include "caf/resumable.hpp"
+#include "caf/telemetry/worker_metrics.hpp"
 
 namespace caf::scheduler {
 
@@ -46,7 +51,19 @@ public:
       id_(worker_id),
       parent_(worker_parent),
       data_(init) {
-    // nop
+    if (worker_parent->is_pool())
+      pool_ = worker_parent;
+    auto resume_time = worker_parent->max_resume_time();
+    if (resume_time.count() > 0) {
+      resume_budget_ = std::max(detail::tsc_clock::ticks(resume_time),
+                                uint64_t{1});
+      adaptive_resume_budget_ = worker_parent->adaptive_resume_time();
+    }
+    auto& sys = worker_parent->system();
+    if (sys.metrics_enabled())
+      metrics_ = sys.metrics().worker_instances(
+        worker_parent->is_pool() ? worker_parent->pool_name() : "default",
+        worker_id);
   }
 
   void start() {
@@ -54,7 +71,9 @@ public:
     auto this_worker = this;
     this_thread_ = std::thread{[this_worker] {
       CAF_SET_LOGGER_SYS(&this_worker->system());
-      detail::set_thread_name("caf.worker");
+      detail::set_thread_name(this_worker->parent_->is_pool()
+                                ? "caf.pool.worker"
+                                : "caf.worker");
       this_worker->system().thread_started();
       this_worker->run();
       this_worker->system().thread_terminates();
@@ -105,6 +124,12 @@ public:
     return max_throughput_;
   }
 
+  /// Returns the metric instances of this worker. All members are `nullptr`
+  /// if the actor system does not collect metrics.
+  const telemetry::worker_metrics& metrics() const noexcept {
+    return metrics_;
+  }
+
 private:
   void run() {
     CAF_SET_LOGGER_SYS(&system());
@@ -117,6 +142,8 @@ private:
       policy_.before_resume(this, job);
       auto res = job->resume(this, max_throughput_);
       policy_.after_resume(this, job);
+      if (metrics_.resumed_jobs != nullptr)
+        metrics_.resumed_jobs->inc();
       switch (res) {
         case resumable::resume_later: {
           // keep reference to this actor, as it remains in the "loop"
@@ -153,6 +180,8 @@ private:
   policy_data data_;
   // instance of our policy object
   Policy policy_;
+  // metric instances for this worker
+  telemetry::worker_metrics metrics_;
 };
 
 } // namespace caf::scheduler
@@ -22,6 +22,7 @@
 #include "caf/actor_addr.hpp"
 #include "caf/actor_cast.hpp"
 #include "caf/check_typed_input.hpp"
+#include "caf/detail/batching_execution_unit.hpp"
 #include "caf/is_message_sink.hpp"
 #include "caf/local_actor.hpp"
 #include "caf/mailbox_element.hpp"
@@ -102,6 +103,26 @@ void anon_send(const Dest& dest, Ts&&... xs) {
                   std::forward<Ts>(xs)...);
 }
 
+/// Anonymously sends the same message to all actors in `receivers`. All
+/// receivers share a single message payload and the scheduler receives all
+/// actors that become ready in one batch.
+template <message_priority P = message_priority::normal, class Handles,
+          class... Ts>
+void anon_send_all(const Handles& receivers, Ts&&... xs) {
+  static_assert(sizeof...(Ts) > 0, "no message to send");
+  using dest_type = detail::decay_t<decltype(*std::begin(receivers))>;
+  using token = detail::type_list<detail::strip_and_convert_t<Ts>...>;
+  static_assert(response_type_unbox<signatures_of_t<dest_type>, token>::valid,
+                "receiver does not accept given message");
+  auto msg = make_message(std::forward<Ts>(xs)...);
+  detail::batching_execution_unit batch{nullptr};
+  for (auto& dest : receivers)
+    if (dest)
+      batch.enqueue(actor_cast<abstract_actor*>(dest),
+                    make_mailbox_element(nullptr, make_message_id(P),
+                                         no_stages, msg));
+}
+
 template <message_priority P = message_priority::normal, class Dest = actor,
           class Rep = int, class Period = std::ratio<1>, class... Ts>
 detail::enable_if_t<!std::is_same<Dest, group>::value>
@@ -0,0 +1,42 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/gauge.hpp"
+
+namespace caf::telemetry {
+
+/// Bundles the metric instances for all actors with the same name. Actors
+/// only carry a pointer to this struct if the actor system collects metrics.
+struct actor_metrics {
+  /// Counts messages that arrived in the mailbox.
+  counter* received = nullptr;
+
+  /// Counts messages that the actors consumed.
+  counter* processed = nullptr;
+
+  /// Counts messages that the actors sent.
+  counter* sent = nullptr;
+
+  /// Counts messages that wait in the mailbox.
+  gauge* mailbox_size = nullptr;
+};
+
+} // namespace caf::telemetry
@@ -0,0 +1,70 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "caf/telemetry/shard.hpp"
+
+namespace caf::telemetry {
+
+/// An integer metric that can go up and down. Stores one cell per shard to
+/// avoid contention between threads and sums up all cells on read.
+class gauge {
+public:
+  gauge() = default;
+
+  gauge(const gauge&) = delete;
+
+  gauge& operator=(const gauge&) = delete;
+
+  /// Increments the gauge by 1.
+  void inc() noexcept {
+    inc(1);
+  }
+
+  /// Increments the gauge by `amount`.
+  void inc(int64_t amount) noexcept {
+    cells_[this_shard()].value.fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  /// Decrements the gauge by 1.
+  void dec() noexcept {
+    inc(-1);
+  }
+
+  /// Decrements the gauge by `amount`.
+  void dec(int64_t amount) noexcept {
+    inc(-amount);
+  }
+
+  /// Returns the current value of the gauge.
+  int64_t value() const noexcept {
+    int64_t result = 0;
+    for (auto& cell : cells_)
+      result += cell.value.load(std::memory_order_relaxed);
+    return result;
+  }
+
+private:
+  std::array<int_cell, num_shards> cells_;
+};
+
+} // namespace caf::telemetry
@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+#include "caf/telemetry/shard.hpp"
+
+namespace caf::telemetry {
+
+/// Samples observations into buckets with fixed upper bounds. Stores one set
+/// of buckets per shard to avoid contention between threads and sums up all
+/// shards on read.
+class CAF_CORE_EXPORT histogram {
+public:
+  /// @pre `upper_bounds` is sorted in ascending order.
+  explicit histogram(std::vector<double> upper_bounds);
+
+  histogram(const histogram&) = delete;
+
+  histogram& operator=(const histogram&) = delete;
+
+  /// Adds `value` to the first bucket with an upper bound of at least `value`
+  /// or to the implicit overflow bucket if `value` exceeds all bounds.
+  void observe(double value) noexcept;
+
+  /// Returns the upper bounds of all buckets except the overflow bucket.
+  const std::vector<double>& upper_bounds() const noexcept {
+    return upper_bounds_;
+  }
+
+  /// Returns the number of observations per bucket, with the overflow bucket
+  /// as last element. The counts are *not* cumulative.
+  std::vector<int64_t> bucket_counts() const;
+
+  /// Returns the sum of all observed values.
+  double sum() const noexcept;
+
+  /// Returns the number of observed values.
+  int64_t count() const noexcept;
+
+private:
+  struct alignas(CAF_CACHE_LINE_SIZE) shard {
+    std::unique_ptr<std::atomic<int64_t>[]> counts;
+    std::atomic<double> sum{0.};
+  };
+
+  std::vector<double> upper_bounds_;
+
+  std::array<shard, num_shards> shards_;
+};
+
+} // namespace caf::telemetry
@@ -0,0 +1,113 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "caf/detail/core_export.hpp"
+#include "caf/string_view.hpp"
+#include "caf/telemetry/actor_metrics.hpp"
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/gauge.hpp"
+#include "caf/telemetry/histogram.hpp"
+#include "caf/telemetry/worker_metrics.hpp"
+
+namespace caf::telemetry {
+
+/// Identifies a metric instance within its family by a list of key-value
+/// pairs, e.g., `{{"pool", "default"}, {"worker", "0"}}`.
+using label_list = std::vector<std::pair<std::string, std::string>>;
+
+/// Manages metric instances. Metrics with the same name form a family and
+/// share the same type and help text. Each instance in a family has a unique
+/// set of labels. The registry owns all instances and never destroys an
+/// instance before the registry itself, i.e., callers may keep pointers to
+/// instances and update them without synchronization.
+class CAF_CORE_EXPORT metric_registry {
+public:
+  metric_registry();
+
+  ~metric_registry();
+
+  metric_registry(const metric_registry&) = delete;
+
+  metric_registry& operator=(const metric_registry&) = delete;
+
+  /// Returns the counter with given `labels` in the family `name`. Creates
+  /// the family and the instance on first access.
+  /// @throws std::logic_error if `name` denotes a family of different type.
+  counter* counter_instance(string_view name, const label_list& labels,
+                            string_view helptext);
+
+  /// Returns the gauge with given `labels` in the family `name`. Creates the
+  /// family and the instance on first access.
+  /// @throws std::logic_error if `name` denotes a family of different type.
+  gauge* gauge_instance(string_view name, const label_list& labels,
+                        string_view helptext);
+
+  /// Returns the histogram with given `labels` in the family `name`. Creates
+  /// the family and the instance on first access. Ignores `upper_bounds` if
+  /// the instance already exists.
+  /// @throws std::logic_error if `name` denotes a family of different type.
+  histogram* histogram_instance(string_view name, const label_list& labels,
+                                string_view helptext,
+                                std::vector<double> upper_bounds);
+
+  /// Returns the metric instances for all actors with given `name`.
+  actor_metrics* actor_instances(string_view name);
+
+  /// Returns the metric instances for the worker `id` in `pool`.
+  worker_metrics worker_instances(string_view pool, size_t id);
+
+  /// Renders all metrics in the Prometheus text exposition format.
+  std::string to_prometheus() const;
+
+private:
+  enum class metric_type {
+    counter,
+    gauge,
+    histogram,
+  };
+
+  struct family {
+    metric_type type;
+    std::string helptext;
+    std::map<std::string, std::unique_ptr<counter>> counters;
+    std::map<std::string, std::unique_ptr<gauge>> gauges;
+    std::map<std::string, std::unique_ptr<histogram>> histograms;
+  };
+
+  // Returns the family `name` and creates it if necessary. The caller must
+  // hold `mtx_`.
+  family& get_family(string_view name, metric_type type, string_view helptext);
+
+  mutable std::mutex mtx_;
+
+  std::map<std::string, family> families_;
+
+  std::map<std::string, std::unique_ptr<actor_metrics>> actor_metrics_;
+};
+
+} // namespace caf::telemetry
@@ -0,0 +1,49 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "caf/config.hpp"
+#include "caf/detail/core_export.hpp"
+
+namespace caf::telemetry {
+
+/// Number of cells per metric instance. Threads map to cells in round-robin
+/// order, i.e., two threads only update the same cell if more than
+/// `num_shards` threads update the same metric.
+constexpr size_t num_shards = 16;
+
+/// Returns the shard index for the next thread that updates a metric.
+CAF_CORE_EXPORT size_t next_shard() noexcept;
+
+/// Returns the shard index of the calling thread.
+inline size_t this_shard() noexcept {
+  static thread_local size_t result = next_shard();
+  return result;
+}
+
+/// Stores an integer value on its own cache line.
+struct alignas(CAF_CACHE_LINE_SIZE) int_cell {
+  std::atomic<int64_t> value{0};
+};
+
+} // namespace caf::telemetry
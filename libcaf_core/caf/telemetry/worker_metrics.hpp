@@ -0,0 +1,39 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include "caf/telemetry/counter.hpp"
+#include "caf/telemetry/histogram.hpp"
+
+namespace caf::telemetry {
+
+/// Bundles the metric instances for a single worker of a scheduler. All
+/// pointers are `nullptr` if the actor system does not collect metrics.
+struct worker_metrics {
+  /// Counts how many times the worker called `resume` on a job.
+  counter* resumed_jobs = nullptr;
+
+  /// Counts jobs that the worker took from other workers.
+  counter* steals = nullptr;
+
+  /// Samples how long the worker blocked while waiting for new jobs.
+  histogram* park_time = nullptr;
+};
+
+} // namespace caf::telemetry
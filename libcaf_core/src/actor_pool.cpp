@@ -24,6 +24,7 @@
 #include "caf/send.hpp"
 #include "caf/default_attachable.hpp"
 
+#include "caf/detail/batching_execution_unit.hpp"
 #include "caf/detail/sync_request_bouncer.hpp"
 
 namespace caf {
@@ -55,8 +56,10 @@ void broadcast_dispatch(actor_system&, actor_pool::uplock&,
                         mailbox_element_ptr& ptr, execution_unit* host) {
   CAF_ASSERT(!vec.empty());
   auto msg = ptr->move_content_to_message();
+  detail::batching_execution_unit batch{host};
   for (auto& worker : vec)
-    worker->enqueue(ptr->sender, ptr->mid, msg, host);
+    batch.enqueue(actor_cast<abstract_actor*>(worker),
+                  make_mailbox_element(ptr->sender, ptr->mid, no_stages, msg));
 }
 
 } // namespace
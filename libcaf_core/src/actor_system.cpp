@@ -22,12 +22,14 @@
 
 #include "caf/actor_system_config.hpp"
 #include "caf/defaults.hpp"
+#include "caf/detail/slab_pool.hpp"
 #include "caf/event_based_actor.hpp"
 #include "caf/raise_error.hpp"
 #include "caf/raw_event_based_actor.hpp"
 #include "caf/send.hpp"
 #include "caf/to_string.hpp"
 
+#include "caf/policy/lock_free_work_stealing.hpp"
 #include "caf/policy/work_sharing.hpp"
 #include "caf/policy/work_stealing.hpp"
 
@@ -51,6 +53,38 @@ struct kvstate {
 
 const char* kvstate::name = "config_server";
 
+scheduler::abstract_coordinator* make_scheduler(actor_system& sys,
+                                                atom_value policy) {
+  using namespace scheduler;
+  if (policy == atom("sharing"))
+    return new coordinator<policy::work_sharing>(sys);
+  if (policy == atom("testing"))
+    return new test_coordinator(sys);
+  if (policy == atom("lockfree"))
+    return new coordinator<policy::lock_free_work_stealing>(sys);
+  if (policy != atom("stealing"))
+    std::cerr << "[WARNING] " << deep_to_string(policy)
+              << " is an unrecognized scheduler pollicy, "
+                 "falling back to 'stealing' (i.e. work-stealing)"
+              << std::endl;
+  return new coordinator<policy::work_stealing>(sys);
+}
+
+// The memory pool is a process-wide resource. Hence, only the first actor
+// system in a process applies its `memory.*` settings.
+void configure_memory_pool(const actor_system_config& cfg) {
+  static std::once_flag flag;
+  std::call_once(flag, [&] {
+    namespace mm = defaults::memory;
+    detail::slab_pool::enable(get_or(cfg, "memory.enable-pooling",
+                                     mm::enable_pooling));
+    detail::slab_pool::max_cached_blocks(
+      get_or(cfg, "memory.max-cached-blocks", mm::max_cached_blocks));
+    detail::slab_pool::return_batch_size(
+      get_or(cfg, "memory.return-batch-size", mm::return_batch_size));
+  });
+}
+
 behavior config_serv_impl(stateful_actor<kvstate>* self) {
   CAF_LOG_TRACE("");
   std::string wildcard = "*";
@@ -224,48 +258,39 @@ actor_system::actor_system(actor_system_config& cfg)
     detached_(0),
     cfg_(cfg),
     logger_dtor_done_(false),
-    tracing_context_(cfg.tracing_context) {
+    tracing_context_(cfg.tracing_context),
+    metrics_enabled_(get_or(cfg, "metrics.enable", defaults::metrics::enable)),
+    private_threads_(*this,
+                     get_or(cfg, "scheduler.max-cached-threads",
+                            defaults::scheduler::max_cached_threads),
+                     get_or(cfg, "scheduler.cached-thread-timeout",
+                            defaults::scheduler::cached_thread_timeout)) {
   CAF_SET_LOGGER_SYS(this);
+  configure_memory_pool(cfg);
   for (auto& hook : cfg.thread_hooks_)
     hook->init(*this);
   for (auto& f : cfg.module_factories) {
     auto mod_ptr = f(*this);
     modules_[mod_ptr->id()].reset(mod_ptr);
   }
-  auto& sched = modules_[module::scheduler];
-  using namespace scheduler;
-  using policy::work_sharing;
-  using policy::work_stealing;
-  using share = coordinator<work_sharing>;
-  using steal = coordinator<work_stealing>;
   // set scheduler only if not explicitly loaded by user
-  if (!sched) {
-    enum sched_conf {
-      stealing = 0x0001,
-      sharing = 0x0002,
-      testing = 0x0003,
-    };
-    sched_conf sc = stealing;
-    namespace sr = defaults::scheduler;
-    auto sr_policy = get_or(cfg, "scheduler.policy", sr::policy);
-    if (sr_policy == atom("sharing"))
-      sc = sharing;
-    else if (sr_policy == atom("testing"))
-      sc = testing;
-    else if (sr_policy != atom("stealing"))
-      std::cerr << "[WARNING] " << deep_to_string(sr_policy)
-                << " is an unrecognized scheduler pollicy, "
-                   "falling back to 'stealing' (i.e. work-stealing)"
-                << std::endl;
-    switch (sc) {
-      default: // any invalid configuration falls back to work stealing
-        sched.reset(new steal(*this));
-        break;
-      case sharing:
-        sched.reset(new share(*this));
-        break;
-      case testing:
-        sched.reset(new test_coordinator(*this));
+  auto& sched = modules_[module::scheduler];
+  namespace sr = defaults::scheduler;
+  auto sr_policy = get_or(cfg, "scheduler.policy", sr::policy);
+  if (!sched)
+    sched.reset(make_scheduler(*this, sr_policy));
+  // create additional scheduler pools, each with its own set of workers
+  if (auto pools = get_if<settings>(&content(cfg), "scheduler.pools")) {
+    for (auto& kvp : *pools) {
+      auto& name = kvp.first;
+      if (name.empty())
+        continue;
+      auto policy = get_or(cfg, "scheduler.pools." + name + ".policy",
+                           sr_policy);
+      std::unique_ptr<scheduler::abstract_coordinator> pool{
+        make_scheduler(*this, policy)};
+      pool->pool_name(name);
+      pools_.emplace_back(std::move(pool));
     }
   }
   // initialize state for each module and give each module the opportunity
@@ -275,6 +300,8 @@ actor_system::actor_system(actor_system_config& cfg)
   for (auto& mod : modules_)
     if (mod)
       mod->init(cfg);
+  for (auto& pool : pools_)
+    pool->init(cfg);
   groups_.init(cfg);
   // spawn config and spawn servers (lazily to not access the scheduler yet)
   static constexpr auto Flags = hidden + lazy_init;
@@ -287,6 +314,8 @@ actor_system::actor_system(actor_system_config& cfg)
   for (auto& mod : modules_)
     if (mod)
       mod->start();
+  for (auto& pool : pools_)
+    pool->start();
   groups_.start();
   logger_->start();
 }
@@ -311,12 +340,18 @@ actor_system::~actor_system() {
     for (auto i = modules_.rbegin(); i != modules_.rend(); ++i) {
       auto& ptr = *i;
       if (ptr != nullptr) {
+        // Pools use the clock of the default scheduler, stop them first.
+        if (ptr->id() == module::scheduler)
+          for (auto& pool : pools_)
+            pool->stop();
         CAF_LOG_DEBUG("stop module" << ptr->name());
         ptr->stop();
       }
     }
     await_detached_threads();
+    private_threads_.stop();
     registry_.stop();
+    CAF_LOG_DEBUG(CAF_ARG2("memory-pool", memory_pool_stats()));
   }
   // reset logger and wait until dtor was called
   CAF_SET_LOGGER_SYS(nullptr);
@@ -337,6 +372,26 @@ scheduler::abstract_coordinator& actor_system::scheduler() {
   return *static_cast<ptr>(modules_[module::scheduler].get());
 }
 
+scheduler::abstract_coordinator*
+actor_system::scheduler_pool(string_view name) noexcept {
+  for (auto& pool : pools_)
+    if (pool->pool_name() == name)
+      return pool.get();
+  return nullptr;
+}
+
+scheduler::abstract_coordinator*
+actor_system::checked_scheduler_pool(string_view name) {
+  auto result = scheduler_pool(name);
+  if (result == nullptr) {
+    std::string str{name.begin(), name.end()};
+    CAF_LOG_WARNING("cannot spawn actor in unknown scheduler pool:" << str);
+    std::cerr << "[WARNING] cannot spawn actor in unknown scheduler pool \""
+              << str << '"' << std::endl;
+  }
+  return result;
+}
+
 caf::logger& actor_system::logger() {
   return *logger_;
 }
@@ -404,6 +459,11 @@ actor_id actor_system::next_actor_id() {
   return ++ids_;
 }
 
+actor_system::memory_pool_statistics
+actor_system::memory_pool_stats() const {
+  return detail::slab_pool::stats();
+}
+
 actor_id actor_system::latest_actor_id() const {
   return ids_.load();
 }
@@ -87,25 +87,52 @@ actor_system_config::actor_system_config()
     .add<atom_value>("credit-policy",
                      "selects an algorithm for credit computation");
   opt_group{custom_options_, "scheduler"}
-    .add<atom_value>("policy", "'stealing' (default) or 'sharing'")
+    .add<atom_value>("policy",
+                      "'stealing' (default), 'lockfree' or 'sharing'")
     .add<size_t>("max-threads", "maximum number of worker threads")
+    .add<size_t>("max-cached-threads",
+                 "max. number of idle threads kept for detached actors")
+    .add<timespan>("cached-thread-timeout",
+                   "time an idle thread waits for a new detached actor")
     .add<size_t>("max-throughput", "nr. of messages actors can consume per run")
+    .add<timespan>("max-resume-time",
+                   "max. time actors can run per activation (0 disables)")
+    .add<bool>("adaptive-resume-time",
+               "derive per-actor message quotas from the max. resume time")
+    .add<bool>("affinity", "pins each worker thread to one CPU")
+    .add<bool>("numa-aware", "steal from workers on nearby CPUs first")
+    .add<bool>("sticky-scheduling",
+               "schedule actors on the worker that ran them last")
+    .add<size_t>("sticky-max-backlog",
+                 "max. queue size of the last worker for sticky scheduling")
+    .add<atom_value>("clock", "'simple' (default) or 'wheel'")
+    .add<timespan>("clock-resolution",
+                   "tick length of the 'wheel' clock")
+    .add<settings>("pools", "named scheduler pools with individual settings")
     .add<bool>("enable-profiling", "enables profiler output")
     .add<timespan>("profiling-resolution", "data collection rate")
     .add<string>("profiling-output-file", "output file for the profiler");
   opt_group(custom_options_, "work-stealing")
-    .add<size_t>("aggressive-poll-attempts", "nr. of aggressive steal attempts")
+    .add<size_t>("aggressive-poll-attempts",
+                 "nr. of poll attempts before parking a worker")
     .add<size_t>("aggressive-steal-interval",
-                 "frequency of aggressive steal attempts")
-    .add<size_t>("moderate-poll-attempts", "nr. of moderate steal attempts")
-    .add<size_t>("moderate-steal-interval",
-                 "frequency of moderate steal attempts")
+                 "frequency of steal attempts while polling")
+    .add<size_t>("moderate-poll-attempts", "DEPRECATED: workers park instead")
+    .add<size_t>("moderate-steal-interval", "DEPRECATED: workers park instead")
     .add<timespan>("moderate-sleep-duration",
-                   "sleep duration between moderate steal attempts")
-    .add<size_t>("relaxed-steal-interval",
-                 "frequency of relaxed steal attempts")
+                   "DEPRECATED: workers park instead")
+    .add<size_t>("relaxed-steal-interval", "DEPRECATED: workers park instead")
     .add<timespan>("relaxed-sleep-duration",
-                   "sleep duration between relaxed steal attempts");
+                   "DEPRECATED: workers park instead");
+  opt_group{custom_options_, "memory"}
+    .add<bool>("enable-pooling",
+               "recycle memory of mailbox elements and messages")
+    .add<size_t>("max-cached-blocks",
+                 "max. number of free blocks per size class and thread")
+    .add<size_t>("return-batch-size",
+                 "nr. of blocks collected before returning them to a thread");
+  opt_group{custom_options_, "metrics"}
+    .add<bool>("enable", "collect metrics for the scheduler and actors");
   opt_group{custom_options_, "logger"}
     .add<atom_value>("verbosity", "default verbosity for file and console")
     .add<string>("file-name", "filesystem path of the log file")
@@ -132,7 +159,14 @@ actor_system_config::actor_system_config()
                "schedule utility actors instead of dedicating threads")
     .add<bool>("manual-multiplexing",
                "disables background activity of the multiplexer")
-    .add<size_t>("workers", "number of deserialization workers");
+    .add<size_t>("workers", "number of deserialization workers")
+    .add<size_t>("multiplexer-threads",
+                 "number of I/O event loops for user-defined brokers "
+                 "(BASP always uses the first one)")
+    .add<uint16_t>("prometheus-http-port",
+                   "serves metrics via HTTP on this port (0 disables)")
+    .add<string>("prometheus-http-address",
+                 "restricts the Prometheus endpoint to this address");
   opt_group(custom_options_, "openssl")
     .add<string>(openssl_certificate, "certificate",
                  "path to the PEM-formatted certificate file")
@@ -168,8 +202,26 @@ settings actor_system_config::dump_content() const {
   auto& scheduler_group = result["scheduler"].as_dictionary();
   put_missing(scheduler_group, "policy", defaults::scheduler::policy);
   put_missing(scheduler_group, "max-threads", defaults::scheduler::max_threads);
+  put_missing(scheduler_group, "max-cached-threads",
+              defaults::scheduler::max_cached_threads);
+  put_missing(scheduler_group, "cached-thread-timeout",
+              defaults::scheduler::cached_thread_timeout);
   put_missing(scheduler_group, "max-throughput",
               defaults::scheduler::max_throughput);
+  put_missing(scheduler_group, "max-resume-time",
+              defaults::scheduler::max_resume_time);
+  put_missing(scheduler_group, "adaptive-resume-time",
+              defaults::scheduler::adaptive_resume_time);
+  put_missing(scheduler_group, "affinity", defaults::scheduler::affinity);
+  put_missing(scheduler_group, "numa-aware", defaults::scheduler::numa_aware);
+  put_missing(scheduler_group, "sticky-scheduling",
+              defaults::scheduler::sticky_scheduling);
+  put_missing(scheduler_group, "sticky-max-backlog",
+              defaults::scheduler::sticky_max_backlog);
+  put_missing(scheduler_group, "clock", defaults::scheduler::clock);
+  put_missing(scheduler_group, "clock-resolution",
+              defaults::scheduler::clock_resolution);
+  put_missing(scheduler_group, "pools", settings{});
   put_missing(scheduler_group, "enable-profiling", false);
   put_missing(scheduler_group, "profiling-resolution",
               defaults::scheduler::profiling_resolution);
@@ -190,6 +242,16 @@ settings actor_system_config::dump_content() const {
               defaults::work_stealing::relaxed_steal_interval);
   put_missing(work_stealing_group, "relaxed-sleep-duration",
               defaults::work_stealing::relaxed_sleep_duration);
+  // -- memory parameters
+  auto& memory_group = result["memory"].as_dictionary();
+  put_missing(memory_group, "enable-pooling", defaults::memory::enable_pooling);
+  put_missing(memory_group, "max-cached-blocks",
+              defaults::memory::max_cached_blocks);
+  put_missing(memory_group, "return-batch-size",
+              defaults::memory::return_batch_size);
+  // -- metrics parameters
+  auto& metrics_group = result["metrics"].as_dictionary();
+  put_missing(metrics_group, "enable", defaults::metrics::enable);
   // -- logger parameters
   auto& logger_group = result["logger"].as_dictionary();
   put_missing(logger_group, "file-name", defaults::logger::file_name);
@@ -211,6 +273,12 @@ settings actor_system_config::dump_content() const {
   put_missing(middleman_group, "heartbeat-interval",
               defaults::middleman::heartbeat_interval);
   put_missing(middleman_group, "workers", defaults::middleman::workers);
+  put_missing(middleman_group, "multiplexer-threads",
+              defaults::middleman::multiplexer_threads);
+  put_missing(middleman_group, "prometheus-http-port",
+              defaults::middleman::prometheus_http_port);
+  put_missing(middleman_group, "prometheus-http-address",
+              defaults::middleman::prometheus_http_address);
   // -- openssl parameters
   auto& openssl_group = result["openssl"].as_dictionary();
   put_missing(openssl_group, "certificate", std::string{});
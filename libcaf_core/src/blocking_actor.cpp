@@ -24,7 +24,7 @@
 #include "caf/actor_system.hpp"
 #include "caf/detail/default_invoke_result_visitor.hpp"
 #include "caf/detail/invoke_result_visitor.hpp"
-#include "caf/detail/set_thread_name.hpp"
+#include "caf/detail/private_thread_pool.hpp"
 #include "caf/detail/sync_request_bouncer.hpp"
 #include "caf/invoke_message_result.hpp"
 #include "caf/logger.hpp"
@@ -95,10 +95,8 @@ void blocking_actor::launch(execution_unit*, bool, bool hide) {
   if (!hide)
     register_at_system();
   home_system().inc_detached_threads();
-  std::thread([](strong_actor_ptr ptr) {
+  auto job = [ptr = strong_actor_ptr{ctrl()}] {
     // actor lives in its own thread
-    detail::set_thread_name("caf.actor");
-    ptr->home_system->thread_started();
     auto this_ptr = ptr->get();
     CAF_ASSERT(dynamic_cast<blocking_actor*>(this_ptr) != nullptr);
     auto self = static_cast<blocking_actor*>(this_ptr);
@@ -126,9 +124,10 @@ void blocking_actor::launch(execution_unit*, bool, bool hide) {
     self->on_exit();
 #   endif
     self->cleanup(std::move(rsn), self->context());
-    ptr->home_system->thread_terminates();
     ptr->home_system->dec_detached_threads();
-  }, strong_actor_ptr{ctrl()}).detach();
+  };
+  using job_type = detail::private_thread_pool::job_type;
+  home_system().private_threads().run(job_type{std::move(job)});
 }
 
 blocking_actor::receive_while_helper
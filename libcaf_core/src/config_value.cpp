@@ -92,6 +92,18 @@ expected<config_value> config_value::parse(string_view str) {
   return parse(str.begin(), str.end());
 }
 
+namespace detail {
+
+void parse(string_parser_state& ps, config_value& x) {
+  ps.skip_whitespaces();
+  ini_value_consumer f;
+  parser::read_ini_value(ps, f);
+  if (ps.code <= pec::trailing_character)
+    x = std::move(f.result);
+}
+
+} // namespace detail
+
 // -- properties ---------------------------------------------------------------
 
 void config_value::convert_to_list() {
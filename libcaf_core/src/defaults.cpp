@@ -23,6 +23,8 @@
 #include <limits>
 #include <thread>
 
+#include "caf/detail/slab_pool.hpp"
+
 using std::max;
 using std::min;
 
@@ -65,8 +67,18 @@ namespace scheduler {
 const atom_value policy = atom("stealing");
 string_view profiling_output_file = "";
 const size_t max_threads = max(std::thread::hardware_concurrency(), 4u);
+const size_t max_cached_threads = 8;
+const timespan cached_thread_timeout = ms(10000);
 const size_t max_throughput = std::numeric_limits<size_t>::max();
+const timespan max_resume_time = timespan{0};
+const bool adaptive_resume_time = false;
 const timespan profiling_resolution = ms(100);
+const bool affinity = false;
+const bool numa_aware = false;
+const bool sticky_scheduling = false;
+const size_t sticky_max_backlog = 16;
+const atom_value clock = atom("simple");
+const timespan clock_resolution = ms(1);
 
 } // namespace scheduler
 
@@ -82,6 +94,20 @@ const timespan relaxed_sleep_duration = ms(10);
 
 } // namespace work_stealing
 
+namespace memory {
+
+const bool enable_pooling = true;
+const size_t max_cached_blocks = detail::slab_pool::default_max_cached_blocks;
+const size_t return_batch_size = detail::slab_pool::default_return_batch_size;
+
+} // namespace memory
+
+namespace metrics {
+
+const bool enable = false;
+
+} // namespace metrics
+
 namespace logger {
 
 string_view component_filter = "";
@@ -103,6 +129,9 @@ const size_t heartbeat_interval = 0;
 const size_t cached_udp_buffers = 10;
 const size_t max_pending_msgs = 10;
 const size_t workers = min(3u, std::thread::hardware_concurrency() / 4u) + 1;
+const size_t multiplexer_threads = 1;
+const uint16_t prometheus_http_port = 0;
+string_view prometheus_http_address = "";
 
 } // namespace middleman
 
@@ -0,0 +1,61 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/batching_execution_unit.hpp"
+
+#include "caf/abstract_actor.hpp"
+#include "caf/actor_system.hpp"
+#include "caf/scheduler/abstract_coordinator.hpp"
+
+namespace caf::detail {
+
+batching_execution_unit::batching_execution_unit(
+  execution_unit* host) noexcept {
+  if (host != nullptr)
+    proxies_ = host->proxy_registry_ptr();
+}
+
+batching_execution_unit::~batching_execution_unit() {
+  flush();
+}
+
+void batching_execution_unit::exec_later(resumable* ptr) {
+  CAF_ASSERT(ptr != nullptr);
+  jobs_.emplace_back(ptr);
+}
+
+void batching_execution_unit::enqueue(abstract_actor* dest,
+                                      mailbox_element_ptr what) {
+  CAF_ASSERT(dest != nullptr);
+  // All jobs of a batch must belong to the same scheduler.
+  auto sys = &dest->home_system();
+  if (sys != system_) {
+    flush();
+    system_ = sys;
+  }
+  dest->enqueue(std::move(what), this);
+}
+
+void batching_execution_unit::flush() {
+  if (jobs_.empty())
+    return;
+  system().scheduler().enqueue_batch(make_span(jobs_));
+  jobs_.clear();
+}
+
+} // namespace caf::detail
@@ -72,6 +72,22 @@ public:
   }
 };
 
+// Calls each match case in order until one of them either matches or skips.
+match_case::result invoke_first(detail::invoke_result_visitor& f,
+                                type_erased_tuple& xs,
+                                const std::vector<match_case*>& cases) {
+  for (auto ptr : cases)
+    switch (ptr->invoke(f, xs)) {
+      case match_case::no_match:
+        break;
+      case match_case::match:
+        return match_case::match;
+      case match_case::skip:
+        return match_case::skip;
+    }
+  return match_case::no_match;
+}
+
 } // namespace
 
 behavior_impl::~behavior_impl() {
@@ -97,6 +113,21 @@ behavior_impl::invoke_empty(detail::invoke_result_visitor& f) {
 match_case::result
 behavior_impl::invoke(detail::invoke_result_visitor& f, type_erased_tuple& xs) {
   auto msg_token = xs.type_token();
+  if (!dispatch_.empty()) {
+    auto i = dispatch_.find(msg_token);
+    if (i == dispatch_.end())
+      return match_case::no_match;
+    auto& entry = i->second;
+    // Type tokens only encode the last elements of long messages, so we need
+    // to check the type of the first element explicitly.
+    if (!entry.by_atom.empty()
+        && xs.matches(0, type_nr<atom_value>::value, nullptr)) {
+      auto j = entry.by_atom.find(*static_cast<const atom_value*>(xs.get(0)));
+      if (j != entry.by_atom.end())
+        return invoke_first(f, xs, j->second);
+    }
+    return invoke_first(f, xs, entry.generic);
+  }
   for (auto i = begin_; i != end_; ++i)
     if (i->type_token == msg_token)
       switch (i->ptr->invoke(f, xs)) {
@@ -136,6 +167,29 @@ behavior_impl::invoke(detail::invoke_result_visitor& f, message& xs) {
   return invoke_empty(f);
 }
 
+void behavior_impl::init_dispatch() {
+  dispatch_.clear();
+  if (static_cast<size_t>(end_ - begin_) < dispatch_threshold)
+    return;
+  // Create all entries first to make sure match cases without leading atom
+  // constant get added to each list of their entry.
+  for (auto i = begin_; i != end_; ++i) {
+    auto& entry = dispatch_[i->type_token];
+    if (auto& x = i->ptr->leading_atom())
+      entry.by_atom[*x];
+  }
+  for (auto i = begin_; i != end_; ++i) {
+    auto& entry = dispatch_[i->type_token];
+    if (auto& x = i->ptr->leading_atom()) {
+      entry.by_atom[*x].emplace_back(i->ptr);
+    } else {
+      entry.generic.emplace_back(i->ptr);
+      for (auto& kvp : entry.by_atom)
+        kvp.second.emplace_back(i->ptr);
+    }
+  }
+}
+
 void behavior_impl::handle_timeout() {
   // nop
 }
@@ -0,0 +1,211 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "caf/config.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <tuple>
+#include <utility>
+
+#include "caf/string_algorithms.hpp"
+
+#ifdef CAF_LINUX
+#  include <pthread.h>
+#  include <sched.h>
+#endif // CAF_LINUX
+
+namespace caf::detail {
+
+namespace {
+
+#ifdef CAF_LINUX
+
+// Reads the first line of a sysfs file, returns an empty string on error.
+std::string read_sysfs(const std::string& path) {
+  std::string result;
+  std::ifstream in{path};
+  if (in)
+    std::getline(in, result);
+  return result;
+}
+
+// Reads a single unsigned integer from a sysfs file.
+size_t read_sysfs_num(const std::string& path, size_t fallback) {
+  auto str = read_sysfs(path);
+  if (str.empty() || str.front() < '0' || str.front() > '9')
+    return fallback;
+  return static_cast<size_t>(std::stoul(str));
+}
+
+#endif // CAF_LINUX
+
+} // namespace
+
+cpu_topology::cpu_topology(std::vector<cpu_info> cpus)
+  : cpus_(std::move(cpus)) {
+  // nop
+}
+
+cpu_topology cpu_topology::detect() {
+  std::vector<cpu_info> cpus;
+#ifdef CAF_LINUX
+  std::string prefix = "/sys/devices/system/";
+  auto ids = parse_cpu_list(read_sysfs(prefix + "cpu/online"));
+  // Drop CPUs outside of our affinity mask, e.g., when running in a container
+  // with a restricted cpuset or when started via `taskset`.
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  if (sched_getaffinity(0, sizeof(cpu_set_t), &mask) == 0) {
+    auto not_allowed = [&](size_t id) {
+      return id >= CPU_SETSIZE || !CPU_ISSET(id, &mask);
+    };
+    ids.erase(std::remove_if(ids.begin(), ids.end(), not_allowed), ids.end());
+  }
+  // Map each CPU to its NUMA node.
+  std::map<size_t, size_t> numa_nodes;
+  for (auto node : parse_cpu_list(read_sysfs(prefix + "node/online"))) {
+    auto path = prefix + "node/node" + std::to_string(node) + "/cpulist";
+    for (auto cpu : parse_cpu_list(read_sysfs(path)))
+      numa_nodes.emplace(cpu, node);
+  }
+  for (auto id : ids) {
+    auto path = prefix + "cpu/cpu" + std::to_string(id);
+    cpu_info info;
+    info.id = id;
+    info.core = read_sysfs_num(path + "/topology/core_id", id);
+    info.package = read_sysfs_num(path + "/topology/physical_package_id", 0);
+    auto i = numa_nodes.find(id);
+    info.numa_node = i != numa_nodes.end() ? i->second : 0;
+    // We use the lowest CPU ID sharing the L3 cache as ID of the cache group.
+    // Machines without L3 cache simply use the package instead.
+    auto l3_path = path + "/cache/index3/shared_cpu_list";
+    auto l3 = parse_cpu_list(read_sysfs(l3_path));
+    info.cache_group = l3.empty() ? info.package
+                                  : *std::min_element(l3.begin(), l3.end());
+    auto siblings = parse_cpu_list(
+      read_sysfs(path + "/topology/thread_siblings_list"));
+    info.smt_rank = static_cast<size_t>(
+      std::count_if(siblings.begin(), siblings.end(),
+                    [id](size_t x) { return x < id; }));
+    cpus.emplace_back(info);
+  }
+  if (!cpus.empty())
+    return cpu_topology{std::move(cpus)};
+#endif // CAF_LINUX
+  auto num = std::max(std::thread::hardware_concurrency(), 1u);
+  for (size_t id = 0; id < num; ++id)
+    cpus.emplace_back(cpu_info{id, id, 0, 0, 0, 0});
+  return cpu_topology{std::move(cpus)};
+}
+
+std::vector<size_t> cpu_topology::parse_cpu_list(string_view str) {
+  std::vector<size_t> result;
+  auto to_num = [](string_view x, size_t& out) {
+    if (x.empty())
+      return false;
+    size_t n = 0;
+    for (auto c : x) {
+      if (c < '0' || c > '9')
+        return false;
+      n = n * 10 + static_cast<size_t>(c - '0');
+    }
+    out = n;
+    return true;
+  };
+  std::vector<string_view> ranges;
+  split(ranges, str, ',', token_compress_on);
+  for (auto range : ranges) {
+    while (!range.empty() && (range.back() == '\n' || range.back() == ' '))
+      range.remove_suffix(1);
+    auto sep = range.find('-');
+    size_t first = 0;
+    size_t last = 0;
+    if (sep == string_view::npos) {
+      if (!to_num(range, first))
+        return {};
+      last = first;
+    } else if (!to_num(range.substr(0, sep), first)
+               || !to_num(range.substr(sep + 1), last) || last < first) {
+      return {};
+    }
+    for (auto i = first; i <= last; ++i)
+      result.emplace_back(i);
+  }
+  return result;
+}
+
+worker_placement cpu_topology::place(size_t num_workers) const {
+  worker_placement result;
+  if (cpus_.empty() || num_workers == 0)
+    return result;
+  // Order CPUs such that consecutive workers share caches and NUMA nodes while
+  // using one hardware thread per physical core before using SMT siblings.
+  auto order = cpus_;
+  auto key = [](const cpu_info& x) {
+    return std::make_tuple(x.smt_rank, x.numa_node, x.cache_group, x.package,
+                           x.core, x.id);
+  };
+  std::sort(order.begin(), order.end(),
+            [&](const cpu_info& x, const cpu_info& y) {
+              return key(x) < key(y);
+            });
+  for (size_t i = 0; i < num_workers; ++i)
+    result.cpus.emplace_back(order[i % order.size()]);
+  // Compute the steal tiers for each worker.
+  result.steal_tiers.resize(num_workers);
+  for (size_t i = 0; i < num_workers; ++i) {
+    auto& self = result.cpus[i];
+    auto& tiers = result.steal_tiers[i];
+    tiers.resize(3);
+    for (size_t j = 0; j < num_workers; ++j) {
+      if (i == j)
+        continue;
+      auto& other = result.cpus[j];
+      if (other.numa_node != self.numa_node)
+        tiers[2].emplace_back(j);
+      else if (other.cache_group != self.cache_group)
+        tiers[1].emplace_back(j);
+      else
+        tiers[0].emplace_back(j);
+    }
+  }
+  return result;
+}
+
+bool set_thread_affinity(std::thread& thread, size_t cpu) {
+#ifdef CAF_LINUX
+  if (cpu >= CPU_SETSIZE)
+    return false;
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t),
+                                &set)
+         == 0;
+#else  // CAF_LINUX
+  CAF_IGNORE_UNUSED(thread);
+  CAF_IGNORE_UNUSED(cpu);
+  return false;
+#endif // CAF_LINUX
+}
+
+} // namespace caf::detail
@@ -20,6 +20,8 @@
 
 #include <cstring>
 
+#include "caf/detail/slab_pool.hpp"
+
 namespace caf::detail {
 
 message_data::~message_data() {
@@ -30,4 +32,16 @@ bool message_data::shared() const noexcept {
   return !unique();
 }
 
+#ifndef CAF_NO_MEM_MANAGEMENT
+
+void* message_data::operator new(size_t bytes) {
+  return slab_pool::allocate(bytes);
+}
+
+void message_data::operator delete(void* ptr) noexcept {
+  slab_pool::deallocate(ptr);
+}
+
+#endif // CAF_NO_MEM_MANAGEMENT
+
 } // namespace caf::detail
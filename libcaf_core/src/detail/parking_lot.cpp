@@ -0,0 +1,88 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/parking_lot.hpp"
+
+#include <climits>
+
+#ifdef CAF_LINUX
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif // CAF_LINUX
+
+namespace caf::detail {
+
+namespace {
+
+#ifdef CAF_LINUX
+
+static_assert(sizeof(std::atomic<parking_lot::key_type>) == sizeof(int),
+              "futex requires a 32-bit atomic");
+
+void futex_wait(std::atomic<parking_lot::key_type>* addr,
+                parking_lot::key_type expected) {
+  syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAIT_PRIVATE,
+          static_cast<int>(expected), nullptr, nullptr, 0);
+}
+
+void futex_wake(std::atomic<parking_lot::key_type>* addr, int num) {
+  syscall(SYS_futex, reinterpret_cast<int*>(addr), FUTEX_WAKE_PRIVATE, num,
+          nullptr, nullptr, 0);
+}
+
+#endif // CAF_LINUX
+
+} // namespace
+
+parking_lot::parking_lot() : epoch_(0), waiters_(0), parks_(0), unparks_(0) {
+  // nop
+}
+
+void parking_lot::park(key_type key) {
+  parks_.fetch_add(1, std::memory_order_relaxed);
+#ifdef CAF_LINUX
+  // The kernel returns immediately if epoch_ no longer equals key. Spurious
+  // wakeups are harmless, since callers check for work again anyway.
+  while (epoch_.load(std::memory_order_acquire) == key)
+    futex_wait(&epoch_, key);
+#else  // CAF_LINUX
+  std::unique_lock<std::mutex> guard{mtx_};
+  cv_.wait(guard, [&] { return epoch_.load() != key; });
+#endif // CAF_LINUX
+  waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void parking_lot::notify(bool all) {
+  unparks_.fetch_add(1, std::memory_order_relaxed);
+#ifdef CAF_LINUX
+  epoch_.fetch_add(1, std::memory_order_release);
+  futex_wake(&epoch_, all ? INT_MAX : 1);
+#else  // CAF_LINUX
+  {
+    std::unique_lock<std::mutex> guard{mtx_};
+    epoch_.fetch_add(1, std::memory_order_release);
+  }
+  if (all)
+    cv_.notify_all();
+  else
+    cv_.notify_one();
+#endif // CAF_LINUX
+}
+
+} // namespace caf::detail
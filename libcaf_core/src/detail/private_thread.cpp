@@ -19,7 +19,7 @@
 #include "caf/detail/private_thread.hpp"
 
 #include "caf/config.hpp"
-#include "caf/detail/set_thread_name.hpp"
+#include "caf/detail/private_thread_pool.hpp"
 #include "caf/logger.hpp"
 #include "caf/scheduled_actor.hpp"
 
@@ -87,14 +87,11 @@ void private_thread::shutdown() {
 }
 
 void private_thread::exec(private_thread* this_ptr) {
-  detail::set_thread_name("caf.actor");
-  this_ptr->system_.thread_started();
   this_ptr->run();
   // make sure to not destroy the private thread object before the
   // detached actor is destroyed and this object is unreachable
   this_ptr->await_self_destroyed();
-  // signalize destruction of detached thread to registry
-  this_ptr->system_.thread_terminates();
+  // signalize termination of the detached actor
   this_ptr->system_.dec_detached_threads();
   // done
   delete this_ptr;
@@ -113,7 +110,8 @@ void private_thread::await_self_destroyed() {
 }
 
 void private_thread::start() {
-  std::thread{exec, this}.detach();
+  using job_type = private_thread_pool::job_type;
+  system_.private_threads().run(job_type{[this] { exec(this); }});
 }
 
 } // namespace caf::detail
@@ -0,0 +1,90 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/private_thread_pool.hpp"
+
+#include <thread>
+
+#include "caf/actor_system.hpp"
+#include "caf/config.hpp"
+#include "caf/detail/set_thread_name.hpp"
+
+namespace caf::detail {
+
+private_thread_pool::private_thread_pool(actor_system& sys, size_t max_idle,
+                                         timespan timeout)
+  : sys_(sys), max_idle_(max_idle), timeout_(timeout) {
+  // nop
+}
+
+private_thread_pool::statistics private_thread_pool::stats() const {
+  std::unique_lock<std::mutex> guard{mtx_};
+  return {threads_created_, jobs_started_, idle_};
+}
+
+void private_thread_pool::run(job_type job) {
+  { // Lifetime scope of guard.
+    std::unique_lock<std::mutex> guard{mtx_};
+    CAF_ASSERT(!stopping_);
+    ++jobs_started_;
+    if (idle_ > pending_.size()) {
+      pending_.emplace_back(std::move(job));
+      jobs_cv_.notify_one();
+      return;
+    }
+    ++running_;
+    ++threads_created_;
+  }
+  std::thread{[this](job_type f) { exec(std::move(f)); }, std::move(job)}
+    .detach();
+}
+
+void private_thread_pool::stop() {
+  std::unique_lock<std::mutex> guard{mtx_};
+  stopping_ = true;
+  jobs_cv_.notify_all();
+  while (running_ != 0)
+    done_cv_.wait(guard);
+}
+
+void private_thread_pool::exec(job_type job) {
+  detail::set_thread_name("caf.actor");
+  sys_.thread_started();
+  for (;;) {
+    job();
+    // Release captured state such as actor handles before going idle.
+    job = nullptr;
+    std::unique_lock<std::mutex> guard{mtx_};
+    if (stopping_ || idle_ >= max_idle_)
+      break;
+    ++idle_;
+    jobs_cv_.wait_for(guard, timeout_,
+                      [this] { return stopping_ || !pending_.empty(); });
+    --idle_;
+    if (pending_.empty())
+      break;
+    job = std::move(pending_.front());
+    pending_.pop_front();
+  }
+  sys_.thread_terminates();
+  std::unique_lock<std::mutex> guard{mtx_};
+  if (--running_ == 0)
+    done_cv_.notify_all();
+}
+
+} // namespace caf::detail
@@ -0,0 +1,52 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/scheduling_hints.hpp"
+
+#include "caf/actor_config.hpp"
+#include "caf/resumable.hpp"
+#include "caf/scheduled_actor.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+const scheduled_actor* as_actor(const resumable* job) noexcept {
+  if (job->subtype() != resumable::scheduled_actor)
+    return nullptr;
+  return static_cast<const scheduled_actor*>(job);
+}
+
+} // namespace
+
+size_t pinned_worker(const resumable* job) noexcept {
+  auto self = as_actor(job);
+  return self != nullptr ? self->pinned_worker() : actor_config::no_worker;
+}
+
+size_t last_worker(const resumable* job) noexcept {
+  auto self = as_actor(job);
+  return self != nullptr ? self->last_worker() : actor_config::no_worker;
+}
+
+void last_worker(resumable* job, size_t id) noexcept {
+  if (job->subtype() == resumable::scheduled_actor)
+    static_cast<scheduled_actor*>(job)->last_worker(id);
+}
+
+} // namespace caf::detail
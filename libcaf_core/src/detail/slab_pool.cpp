@@ -0,0 +1,313 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+#include "caf/detail/slab_pool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace caf::detail {
+
+namespace {
+
+struct thread_cache;
+
+// Every block starts with a header. While the block is in use, the header
+// stores the owning cache. While the block sits in a free list, the same
+// field links it to the next free block.
+struct header {
+  union {
+    thread_cache* owner;
+    header* next;
+  };
+  size_t size_class;
+};
+
+constexpr size_t header_size = alignof(std::max_align_t);
+
+static_assert(sizeof(header) <= header_size);
+
+constexpr size_t unpooled = std::numeric_limits<size_t>::max();
+
+constexpr size_t block_size(size_t size_class) {
+  return slab_pool::min_block_size << size_class;
+}
+
+size_t size_class_of(size_t total) {
+  size_t result = 0;
+  while (block_size(result) < total)
+    ++result;
+  return result;
+}
+
+// Increments a counter that only its owning thread writes to.
+void bump(std::atomic<uint64_t>& x) {
+  x.store(x.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+std::atomic<bool> s_enabled{true};
+
+std::atomic<size_t> s_max_cached{slab_pool::default_max_cached_blocks};
+
+std::atomic<size_t> s_batch_size{slab_pool::default_return_batch_size};
+
+struct size_class_cache {
+  /// Free blocks, accessed only by the owning thread.
+  header* free_list = nullptr;
+
+  /// Number of blocks in `free_list`.
+  size_t count = 0;
+
+  /// Blocks returned by other threads.
+  std::atomic<header*> remote{nullptr};
+
+  /// Owner of the blocks in the outgoing batch.
+  thread_cache* batch_owner = nullptr;
+
+  /// First block of the outgoing batch.
+  header* batch_head = nullptr;
+
+  /// Last block of the outgoing batch.
+  header* batch_tail = nullptr;
+
+  /// Number of blocks in the outgoing batch.
+  size_t batch_count = 0;
+};
+
+struct thread_cache {
+  size_class_cache classes[slab_pool::num_size_classes];
+  std::atomic<uint64_t> hits{0};
+  std::atomic<uint64_t> misses{0};
+  std::atomic<uint64_t> bypassed{0};
+  std::atomic<uint64_t> remote_releases{0};
+};
+
+void push_remote(thread_cache* owner, size_t size_class, header* first,
+                 header* last) {
+  auto& stack = owner->classes[size_class].remote;
+  auto top = stack.load(std::memory_order_relaxed);
+  do {
+    last->next = top;
+  } while (!stack.compare_exchange_weak(top, first, std::memory_order_release,
+                                        std::memory_order_relaxed));
+}
+
+void flush_batch(size_class_cache& x, size_t size_class) {
+  if (x.batch_head != nullptr) {
+    push_remote(x.batch_owner, size_class, x.batch_head, x.batch_tail);
+    x.batch_owner = nullptr;
+    x.batch_head = nullptr;
+    x.batch_tail = nullptr;
+    x.batch_count = 0;
+  }
+}
+
+// Moves blocks returned by other threads to the local free list and releases
+// anything exceeding the configured capacity.
+void drain_remote(size_class_cache& x) {
+  auto ptr = x.remote.exchange(nullptr, std::memory_order_acquire);
+  auto max_cached = s_max_cached.load(std::memory_order_relaxed);
+  while (ptr != nullptr) {
+    auto next = ptr->next;
+    if (x.count < max_cached) {
+      ptr->next = x.free_list;
+      x.free_list = ptr;
+      ++x.count;
+    } else {
+      ::operator delete(ptr);
+    }
+    ptr = next;
+  }
+}
+
+// Caches are never destroyed, because blocks may outlive the thread that
+// allocated them. Instead, terminating threads hand their cache over to the
+// next thread that starts using the pool.
+struct cache_registry {
+  std::mutex mtx;
+  std::vector<thread_cache*> all;
+  std::vector<thread_cache*> orphans;
+
+  thread_cache* acquire() {
+    std::lock_guard<std::mutex> guard{mtx};
+    if (!orphans.empty()) {
+      auto result = orphans.back();
+      orphans.pop_back();
+      return result;
+    }
+    auto result = new thread_cache;
+    all.emplace_back(result);
+    return result;
+  }
+
+  void release(thread_cache* ptr) {
+    std::lock_guard<std::mutex> guard{mtx};
+    orphans.emplace_back(ptr);
+  }
+};
+
+cache_registry& registry() {
+  // Intentionally leaked to remain accessible during static destruction.
+  static auto instance = new cache_registry;
+  return *instance;
+}
+
+thread_local thread_cache* t_cache = nullptr;
+
+thread_local bool t_terminated = false;
+
+struct cache_guard {
+  void arm() noexcept {
+    // nop; calling this function forces the compiler to construct the guard
+  }
+
+  ~cache_guard() {
+    if (t_cache == nullptr)
+      return;
+    for (size_t i = 0; i < slab_pool::num_size_classes; ++i)
+      flush_batch(t_cache->classes[i], i);
+    registry().release(t_cache);
+    t_cache = nullptr;
+    t_terminated = true;
+  }
+};
+
+thread_local cache_guard t_guard;
+
+thread_cache* local_cache() {
+  if (t_cache != nullptr || t_terminated)
+    return t_cache;
+  t_guard.arm();
+  t_cache = registry().acquire();
+  return t_cache;
+}
+
+header* to_header(void* ptr) {
+  return reinterpret_cast<header*>(static_cast<char*>(ptr) - header_size);
+}
+
+void* to_payload(header* ptr) {
+  return reinterpret_cast<char*>(ptr) + header_size;
+}
+
+} // namespace
+
+void* slab_pool::allocate(size_t bytes) {
+  auto total = bytes + header_size;
+  auto cache = local_cache();
+  if (cache != nullptr && total <= max_block_size
+      && s_enabled.load(std::memory_order_relaxed)) {
+    auto size_class = size_class_of(total);
+    auto& x = cache->classes[size_class];
+    if (x.free_list == nullptr)
+      drain_remote(x);
+    header* result;
+    if (x.free_list != nullptr) {
+      bump(cache->hits);
+      result = x.free_list;
+      x.free_list = result->next;
+      --x.count;
+    } else {
+      bump(cache->misses);
+      result = static_cast<header*>(::operator new(block_size(size_class)));
+      result->size_class = size_class;
+    }
+    result->owner = cache;
+    return to_payload(result);
+  }
+  if (cache != nullptr)
+    bump(cache->bypassed);
+  auto result = static_cast<header*>(::operator new(total));
+  result->owner = nullptr;
+  result->size_class = unpooled;
+  return to_payload(result);
+}
+
+void slab_pool::deallocate(void* ptr) noexcept {
+  if (ptr == nullptr)
+    return;
+  auto hdr = to_header(ptr);
+  auto size_class = hdr->size_class;
+  if (size_class == unpooled) {
+    ::operator delete(hdr);
+    return;
+  }
+  auto owner = hdr->owner;
+  auto cache = local_cache();
+  if (cache == owner) {
+    auto& x = cache->classes[size_class];
+    if (x.count < s_max_cached.load(std::memory_order_relaxed)) {
+      hdr->next = x.free_list;
+      x.free_list = hdr;
+      ++x.count;
+    } else {
+      ::operator delete(hdr);
+    }
+    return;
+  }
+  if (cache == nullptr) {
+    // Called during thread shutdown.
+    push_remote(owner, size_class, hdr, hdr);
+    return;
+  }
+  bump(cache->remote_releases);
+  auto& x = cache->classes[size_class];
+  if (x.batch_owner != owner) {
+    flush_batch(x, size_class);
+    x.batch_owner = owner;
+    x.batch_tail = hdr;
+  }
+  hdr->next = x.batch_head;
+  x.batch_head = hdr;
+  if (++x.batch_count >= s_batch_size.load(std::memory_order_relaxed))
+    flush_batch(x, size_class);
+}
+
+void slab_pool::enable(bool flag) noexcept {
+  s_enabled.store(flag, std::memory_order_relaxed);
+}
+
+bool slab_pool::enabled() noexcept {
+  return s_enabled.load(std::memory_order_relaxed);
+}
+
+void slab_pool::max_cached_blocks(size_t num) noexcept {
+  s_max_cached.store(num, std::memory_order_relaxed);
+}
+
+void slab_pool::return_batch_size(size_t num) noexcept {
+  s_batch_size.store(std::max(num, size_t{1}), std::memory_order_relaxed);
+}
+
+slab_pool::statistics slab_pool::stats() {
+  statistics result;
+  auto& reg = registry();
+  std::lock_guard<std::mutex> guard{reg.mtx};
+  for (auto cache : reg.all) {
+    result.hits += cache->hits.load(std::memory_order_relaxed);
+    result.misses += cache->misses.load(std::memory_order_relaxed);
+    result.bypassed += cache->bypassed.load(std::memory_order_relaxed);
+    result.remote_releases
+      += cache->remote_releases.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+} // namespace caf::detail
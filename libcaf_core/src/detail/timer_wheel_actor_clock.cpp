@@ -0,0 +1,445 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/timer_wheel_actor_clock.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "caf/abstract_actor.hpp"
+#include "caf/actor_control_block.hpp"
+#include "caf/logger.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+using tick_type = timer_wheel_actor_clock::tick_type;
+
+constexpr tick_type no_tick = std::numeric_limits<tick_type>::max();
+
+constexpr tick_type slot_mask = timer_wheel_actor_clock::num_slots - 1;
+
+constexpr tick_type level_shift(size_t level) {
+  return timer_wheel_actor_clock::slot_bits * level;
+}
+
+} // namespace
+
+// -- constructors, destructors, and assignment operators ----------------------
+
+timer_wheel_actor_clock::timer_wheel_actor_clock(size_t num_shards,
+                                                 timespan resolution)
+  : epoch_(now()),
+    resolution_(std::max(std::chrono::duration_cast<duration_type>(resolution),
+                          duration_type{1})),
+    min_insert_(no_tick),
+    wakeup_tick_(0) {
+  num_shards = std::max(num_shards, size_t{1});
+  shards_.reserve(num_shards);
+  for (size_t i = 0; i < num_shards; ++i)
+    shards_.emplace_back(new shard);
+}
+
+timer_wheel_actor_clock::~timer_wheel_actor_clock() {
+  std::vector<unique_delayed_event_ptr> garbage;
+  for (auto& s : shards_)
+    clear(*s, garbage);
+}
+
+// -- properties ---------------------------------------------------------------
+
+size_t timer_wheel_actor_clock::num_pending() {
+  size_t result = 0;
+  for (auto& s : shards_) {
+    std::lock_guard<std::mutex> guard{s->mtx};
+    result += s->size;
+  }
+  return result;
+}
+
+// -- overridden member functions ----------------------------------------------
+
+void timer_wheel_actor_clock::set_ordinary_timeout(time_point t,
+                                                   abstract_actor* self,
+                                                   atom_value type,
+                                                   uint64_t id) {
+  using event_type = simple_actor_clock::ordinary_timeout;
+  add(self->id(), timeout_kind::ordinary, static_cast<uint64_t>(type), t,
+      unique_delayed_event_ptr{new event_type(t, self->ctrl(), type, id)});
+}
+
+void timer_wheel_actor_clock::set_multi_timeout(time_point t,
+                                                abstract_actor* self,
+                                                atom_value type, uint64_t id) {
+  using event_type = simple_actor_clock::multi_timeout;
+  add(self->id(), timeout_kind::multi, 0, t,
+      unique_delayed_event_ptr{new event_type(t, self->ctrl(), type, id)});
+}
+
+void timer_wheel_actor_clock::set_request_timeout(time_point t,
+                                                  abstract_actor* self,
+                                                  message_id id) {
+  using event_type = simple_actor_clock::request_timeout;
+  add(self->id(), timeout_kind::request, id.integer_value(), t,
+      unique_delayed_event_ptr{new event_type(t, self->ctrl(), id)});
+}
+
+void timer_wheel_actor_clock::cancel_ordinary_timeout(abstract_actor* self,
+                                                      atom_value type) {
+  cancel(timeout_key{self->id(), timeout_kind::ordinary,
+                     static_cast<uint64_t>(type)});
+}
+
+void timer_wheel_actor_clock::cancel_request_timeout(abstract_actor* self,
+                                                     message_id id) {
+  cancel(timeout_key{self->id(), timeout_kind::request, id.integer_value()});
+}
+
+void timer_wheel_actor_clock::cancel_timeouts(abstract_actor* self) {
+  // Destroying events may release the last reference to an actor, so we must
+  // not do this while holding the lock.
+  std::vector<unique_delayed_event_ptr> garbage;
+  auto& s = shard_for(self->id());
+  std::lock_guard<std::mutex> guard{s.mtx};
+  auto i = s.by_actor.find(self->id());
+  if (i == s.by_actor.end())
+    return;
+  for (auto x = i->second; x != nullptr;) {
+    auto next = x->next_of_actor;
+    if (x->kind != timeout_kind::multi)
+      s.by_key.erase(timeout_key{x->aid, x->kind, x->id});
+    garbage.emplace_back(std::move(x->event));
+    x->kind = timeout_kind::message;
+    x->prev_of_actor = nullptr;
+    x->next_of_actor = nullptr;
+    x = next;
+  }
+  s.by_actor.erase(i);
+}
+
+void timer_wheel_actor_clock::schedule_message(time_point t,
+                                               strong_actor_ptr receiver,
+                                               mailbox_element_ptr content) {
+  using event_type = simple_actor_clock::actor_msg;
+  auto aid = receiver != nullptr ? receiver->id() : invalid_actor_id;
+  add(aid, timeout_kind::message, 0, t,
+      unique_delayed_event_ptr{
+        new event_type(t, std::move(receiver), std::move(content))});
+}
+
+void timer_wheel_actor_clock::schedule_message(time_point t, group target,
+                                               strong_actor_ptr sender,
+                                               message content) {
+  using event_type = simple_actor_clock::group_msg;
+  auto aid = sender != nullptr ? sender->id() : invalid_actor_id;
+  add(aid, timeout_kind::message, 0, t,
+      unique_delayed_event_ptr{new event_type(t, std::move(target),
+                                              std::move(sender),
+                                              std::move(content))});
+}
+
+void timer_wheel_actor_clock::cancel_all() {
+  std::vector<unique_delayed_event_ptr> garbage;
+  for (auto& s : shards_) {
+    std::lock_guard<std::mutex> guard{s->mtx};
+    clear(*s, garbage);
+  }
+}
+
+// -- dispatching --------------------------------------------------------------
+
+size_t timer_wheel_actor_clock::trigger_expired_timeouts(time_point t) {
+  tick_type next;
+  return dispatch(to_tick(t, false), next);
+}
+
+void timer_wheel_actor_clock::run_dispatch_loop() {
+  for (;;) {
+    // Producers skip notifications while we are busy and we pick up their
+    // timers via `min_insert_` instead.
+    wakeup_tick_ = 0;
+    min_insert_ = no_tick;
+    tick_type next;
+    dispatch(to_tick(now(), false), next);
+    std::unique_lock<std::mutex> guard{mtx_};
+    if (shutdown_)
+      break;
+    wakeup_tick_ = next;
+    auto pred = [this] {
+      return shutdown_ || min_insert_.load() < wakeup_tick_.load();
+    };
+    if (next == no_tick)
+      cv_.wait(guard, pred);
+    else
+      cv_.wait_until(guard, to_time_point(next), pred);
+    if (shutdown_)
+      break;
+  }
+  cancel_all();
+}
+
+void timer_wheel_actor_clock::cancel_dispatch_loop() {
+  std::lock_guard<std::mutex> guard{mtx_};
+  shutdown_ = true;
+  cv_.notify_all();
+}
+
+// -- utility functions --------------------------------------------------------
+
+size_t timer_wheel_actor_clock::timeout_key_hash::
+operator()(const timeout_key& x) const noexcept {
+  auto result = std::hash<uint64_t>{}(x.id);
+  result ^= std::hash<actor_id>{}(x.aid) + 0x9e3779b9 + (result << 6)
+            + (result >> 2);
+  return result ^ static_cast<size_t>(x.kind);
+}
+
+tick_type timer_wheel_actor_clock::to_tick(time_point t, bool round_up) const
+  noexcept {
+  if (t <= epoch_)
+    return 0;
+  auto delta = t - epoch_;
+  auto result = static_cast<tick_type>(delta / resolution_);
+  if (round_up && delta % resolution_ != duration_type::zero())
+    ++result;
+  return result;
+}
+
+timer_wheel_actor_clock::time_point
+timer_wheel_actor_clock::to_time_point(tick_type tick) const noexcept {
+  using rep = duration_type::rep;
+  auto max_tick = static_cast<tick_type>((time_point::max() - epoch_)
+                                         / resolution_);
+  if (tick >= max_tick)
+    return time_point::max();
+  return epoch_ + resolution_ * static_cast<rep>(tick);
+}
+
+void timer_wheel_actor_clock::insert(shard& s, timer* x) {
+  auto cursor = s.cursor;
+  auto due = x->due;
+  // Pick the lowest level that covers the distance to the cursor.
+  size_t level = 0;
+  while (level + 1 < num_levels
+         && (due >> level_shift(level + 1)) != (cursor >> level_shift(level + 1)))
+    ++level;
+  auto& b = s.levels[level][(due >> level_shift(level)) & slot_mask];
+  x->next = nullptr;
+  if (b.tail == nullptr) {
+    b.head = x;
+    b.tail = x;
+  } else {
+    b.tail->next = x;
+    b.tail = x;
+  }
+}
+
+void timer_wheel_actor_clock::link(shard& s, timer* x) {
+  switch (x->kind) {
+    case timeout_kind::message:
+      return;
+    case timeout_kind::multi:
+      break;
+    default:
+      s.by_key.emplace(timeout_key{x->aid, x->kind, x->id}, x);
+  }
+  auto& head = s.by_actor[x->aid];
+  x->prev_of_actor = nullptr;
+  x->next_of_actor = head;
+  if (head != nullptr)
+    head->prev_of_actor = x;
+  head = x;
+}
+
+void timer_wheel_actor_clock::unlink(shard& s, timer* x) {
+  switch (x->kind) {
+    case timeout_kind::message:
+      return;
+    case timeout_kind::multi:
+      break;
+    default:
+      s.by_key.erase(timeout_key{x->aid, x->kind, x->id});
+  }
+  if (x->prev_of_actor != nullptr) {
+    x->prev_of_actor->next_of_actor = x->next_of_actor;
+  } else if (x->next_of_actor != nullptr) {
+    s.by_actor[x->aid] = x->next_of_actor;
+  } else {
+    s.by_actor.erase(x->aid);
+  }
+  if (x->next_of_actor != nullptr)
+    x->next_of_actor->prev_of_actor = x->prev_of_actor;
+  x->kind = timeout_kind::message;
+  x->prev_of_actor = nullptr;
+  x->next_of_actor = nullptr;
+}
+
+void timer_wheel_actor_clock::cancel(const timeout_key& key) {
+  unique_delayed_event_ptr garbage;
+  auto& s = shard_for(key.aid);
+  std::lock_guard<std::mutex> guard{s.mtx};
+  auto i = s.by_key.find(key);
+  if (i == s.by_key.end())
+    return;
+  // The timer itself stays in its bucket until the wheel reaches it.
+  auto x = i->second;
+  garbage = std::move(x->event);
+  unlink(s, x);
+}
+
+void timer_wheel_actor_clock::cascade(shard& s, size_t level) {
+  auto& b = s.levels[level][(s.cursor >> level_shift(level)) & slot_mask];
+  auto x = b.head;
+  b = bucket{};
+  while (x != nullptr) {
+    auto next = x->next;
+    if (x->event != nullptr) {
+      insert(s, x);
+    } else {
+      // Drop cancelled timers early.
+      delete x;
+      --s.size;
+    }
+    x = next;
+  }
+}
+
+void timer_wheel_actor_clock::advance(
+  shard& s, tick_type tick, std::vector<unique_delayed_event_ptr>& out) {
+  while (s.cursor < tick) {
+    if (s.size == 0) {
+      s.cursor = tick;
+      return;
+    }
+    auto t = ++s.cursor;
+    // Move timers down from all levels that complete a rotation at `t`,
+    // starting at the highest one.
+    size_t top = 0;
+    while (top + 1 < num_levels
+           && (t & ((tick_type{1} << level_shift(top + 1)) - 1)) == 0)
+      ++top;
+    for (auto level = top; level > 0; --level)
+      cascade(s, level);
+    // Ship all timers in the current bucket.
+    auto& b = s.levels[0][t & slot_mask];
+    auto x = b.head;
+    b = bucket{};
+    while (x != nullptr) {
+      auto next = x->next;
+      if (x->event != nullptr) {
+        unlink(s, x);
+        out.emplace_back(std::move(x->event));
+      }
+      delete x;
+      --s.size;
+      x = next;
+    }
+  }
+}
+
+tick_type timer_wheel_actor_clock::next_tick(shard& s) {
+  if (s.size == 0)
+    return no_tick;
+  auto cursor = s.cursor;
+  auto window = cursor >> slot_bits;
+  for (auto t = cursor + 1; (t >> slot_bits) == window; ++t)
+    if (s.levels[0][t & slot_mask].head != nullptr)
+      return t;
+  // Wake up for cascading the next level.
+  return (window + 1) << slot_bits;
+}
+
+void timer_wheel_actor_clock::clear(
+  shard& s, std::vector<unique_delayed_event_ptr>& out) {
+  for (auto& level : s.levels) {
+    for (auto& b : level) {
+      auto x = b.head;
+      b = bucket{};
+      while (x != nullptr) {
+        auto next = x->next;
+        if (x->event != nullptr)
+          out.emplace_back(std::move(x->event));
+        delete x;
+        x = next;
+      }
+    }
+  }
+  s.size = 0;
+  s.by_actor.clear();
+  s.by_key.clear();
+}
+
+size_t timer_wheel_actor_clock::dispatch(tick_type tick, tick_type& next) {
+  std::vector<unique_delayed_event_ptr> events;
+  next = no_tick;
+  for (auto& s : shards_) {
+    std::lock_guard<std::mutex> guard{s->mtx};
+    advance(*s, tick, events);
+    next = std::min(next, next_tick(*s));
+  }
+  for (auto& x : events)
+    simple_actor_clock::ship(*x);
+  return events.size();
+}
+
+void timer_wheel_actor_clock::add(actor_id aid, timeout_kind kind,
+                                  uint64_t id, time_point t,
+                                  unique_delayed_event_ptr event) {
+  auto x = new timer;
+  x->due = to_tick(t, true);
+  x->aid = aid;
+  x->kind = kind;
+  x->id = id;
+  x->event = std::move(event);
+  unique_delayed_event_ptr garbage;
+  tick_type due;
+  { // Lifetime scope of guard.
+    auto& s = shard_for(aid);
+    std::lock_guard<std::mutex> guard{s.mtx};
+    // Skip ticks that passed while the shard was empty.
+    if (s.size == 0)
+      s.cursor = std::max(s.cursor, to_tick(now(), false));
+    if (kind == timeout_kind::ordinary) {
+      // Ordinary timeouts override any previous timeout of the same type.
+      auto i = s.by_key.find(timeout_key{aid, kind, id});
+      if (i != s.by_key.end()) {
+        auto prev = i->second;
+        garbage = std::move(prev->event);
+        unlink(s, prev);
+      }
+    }
+    // Overdue timers expire on the next tick.
+    x->due = std::max(x->due, s.cursor + 1);
+    link(s, x);
+    insert(s, x);
+    ++s.size;
+    due = x->due;
+  }
+  // Wake up the dispatcher if it sleeps past the new timeout.
+  auto prev = min_insert_.load();
+  while (due < prev && !min_insert_.compare_exchange_weak(prev, due)) {
+    // nop
+  }
+  if (due < wakeup_tick_.load()) {
+    std::lock_guard<std::mutex> guard{mtx_};
+    cv_.notify_one();
+  }
+}
+
+} // namespace caf::detail
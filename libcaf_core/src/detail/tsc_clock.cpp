@@ -0,0 +1,49 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/detail/tsc_clock.hpp"
+
+namespace caf::detail {
+
+namespace {
+
+double calibrate() {
+#ifdef CAF_HAS_TSC
+  // Compare the TSC against the steady clock for a couple of milliseconds.
+  using namespace std::chrono;
+  auto t0 = steady_clock::now();
+  auto c0 = tsc_clock::now();
+  auto t1 = t0;
+  while (t1 - t0 < milliseconds(2))
+    t1 = steady_clock::now();
+  auto c1 = tsc_clock::now();
+  auto ns = duration_cast<nanoseconds>(t1 - t0).count();
+  if (c1 > c0 && ns > 0)
+    return static_cast<double>(c1 - c0) / ns;
+#endif
+  return 1.;
+}
+
+} // namespace
+
+double tsc_clock::ticks_per_ns() noexcept {
+  static const double result = calibrate();
+  return result;
+}
+
+} // namespace caf::detail
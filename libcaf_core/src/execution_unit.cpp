@@ -22,7 +22,8 @@ namespace caf {
 
 execution_unit::execution_unit(actor_system* sys)
     : system_(sys),
-      proxies_(nullptr) {
+      proxies_(nullptr),
+      pool_(nullptr) {
   // nop
 }
 
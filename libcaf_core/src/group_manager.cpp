@@ -29,6 +29,7 @@
 #include "caf/message.hpp"
 #include "caf/serializer.hpp"
 #include "caf/deserializer.hpp"
+#include "caf/detail/batching_execution_unit.hpp"
 #include "caf/event_based_actor.hpp"
 
 #include "caf/group_manager.hpp"
@@ -64,9 +65,13 @@ public:
   void send_all_subscribers(const strong_actor_ptr& sender, const message& msg,
                             execution_unit* host) {
     CAF_LOG_TRACE(CAF_ARG(sender) << CAF_ARG(msg));
+    // Declared before the guard to schedule receivers after unlocking.
+    detail::batching_execution_unit batch{host};
     shared_guard guard(mtx_);
     for (auto& s : subscribers_)
-      s->enqueue(sender, make_message_id(), msg, host);
+      batch.enqueue(actor_cast<abstract_actor*>(s),
+                    make_mailbox_element(sender, make_message_id(), no_stages,
+                                         msg));
   }
 
   void enqueue(strong_actor_ptr sender, message_id, message msg,
@@ -205,8 +210,11 @@ private:
     auto src = current_element_->sender;
     CAF_LOG_DEBUG(CAF_ARG(acquaintances_.size())
                   << CAF_ARG(src) << CAF_ARG(what));
+    detail::batching_execution_unit batch{context()};
     for (auto& acquaintance : acquaintances_)
-      acquaintance->enqueue(src, make_message_id(), what, context());
+      batch.enqueue(actor_cast<abstract_actor*>(acquaintance),
+                    make_mailbox_element(src, make_message_id(), no_stages,
+                                         what));
   }
 
   local_group_ptr group_;
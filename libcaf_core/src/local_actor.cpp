@@ -40,7 +40,8 @@ local_actor::local_actor(actor_config& cfg)
   : monitorable_actor(cfg),
     context_(cfg.host),
     current_element_(nullptr),
-    initial_behavior_fac_(std::move(cfg.init_fun)) {
+    initial_behavior_fac_(std::move(cfg.init_fun)),
+    metrics_(nullptr) {
   // nop
 }
 
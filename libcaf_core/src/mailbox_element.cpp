@@ -18,6 +18,7 @@
 
 #include "caf/mailbox_element.hpp"
 
+#include "caf/detail/slab_pool.hpp"
 #include "caf/message_builder.hpp"
 #include "caf/type_nr.hpp"
 
@@ -88,6 +89,18 @@ mailbox_element::~mailbox_element() {
   // nop
 }
 
+#ifndef CAF_NO_MEM_MANAGEMENT
+
+void* mailbox_element::operator new(size_t bytes) {
+  return detail::slab_pool::allocate(bytes);
+}
+
+void mailbox_element::operator delete(void* ptr) noexcept {
+  detail::slab_pool::deallocate(ptr);
+}
+
+#endif // CAF_NO_MEM_MANAGEMENT
+
 mailbox_element_ptr
 make_mailbox_element(strong_actor_ptr sender, message_id id,
                      mailbox_element::forwarding_stack stages, message msg) {
@@ -28,4 +28,9 @@ match_case::match_case(uint32_t tt) : token_(tt) {
   // nop
 }
 
+match_case::match_case(uint32_t tt, optional<atom_value> leading_atom)
+  : token_(tt), leading_atom_(std::move(leading_atom)) {
+  // nop
+}
+
 } // namespace caf
@@ -0,0 +1,40 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/policy/lock_free_work_stealing.hpp"
+
+#include "caf/scheduler/abstract_coordinator.hpp"
+
+namespace caf::policy {
+
+lock_free_work_stealing::~lock_free_work_stealing() {
+  // nop
+}
+
+lock_free_work_stealing::worker_data::worker_data(
+  scheduler::abstract_coordinator* p)
+  : worker_data_base(p), ticks(0) {
+  // nop
+}
+
+lock_free_work_stealing::worker_data::worker_data(const worker_data& other)
+  : worker_data_base(other), ticks(0) {
+  // nop
+}
+
+} // namespace caf::policy
@@ -18,6 +18,8 @@
 
 #include "caf/policy/work_stealing.hpp"
 
+#include <algorithm>
+
 #include "caf/actor_system_config.hpp"
 #include "caf/config_value.hpp"
 #include "caf/defaults.hpp"
@@ -33,28 +35,52 @@ work_stealing::~work_stealing() {
   // nop
 }
 
-work_stealing::worker_data::worker_data(scheduler::abstract_coordinator* p)
+work_stealing::coordinator_data::coordinator_data(
+  scheduler::abstract_coordinator* p)
+  : next_worker(0),
+    num_parked(0),
+    sticky(get_or(p->config(), "scheduler.sticky-scheduling",
+                  defaults::scheduler::sticky_scheduling)),
+    max_backlog(get_or(p->config(), "scheduler.sticky-max-backlog",
+                       defaults::scheduler::sticky_max_backlog)) {
+  // nop
+}
+
+work_stealing::worker_data_base::worker_data_base(
+  scheduler::abstract_coordinator* p)
   : rengine(std::random_device{}()),
     // no need to worry about wrap-around; if `p->num_workers() < 2`,
     // `uniform` will not be used anyway
     uniform(0, p->num_workers() - 2),
-    strategies{
-      {{CONFIG("aggressive-poll-attempts", aggressive_poll_attempts), 1,
-        CONFIG("aggressive-steal-interval", aggressive_steal_interval),
-        timespan{0}},
-       {CONFIG("moderate-poll-attempts", moderate_poll_attempts), 1,
-        CONFIG("moderate-steal-interval", moderate_steal_interval),
-        CONFIG("moderate-sleep-duration", moderate_sleep_duration)},
-       {1, 0, CONFIG("relaxed-steal-interval", relaxed_steal_interval),
-        CONFIG("relaxed-sleep-duration", relaxed_sleep_duration)}}} {
+    polling(make_poll_strategy(p)),
+    pinned(pinned_log_capacity) {
   // nop
 }
 
-work_stealing::worker_data::worker_data(const worker_data& other)
+work_stealing::worker_data_base::worker_data_base(
+  const worker_data_base& other)
   : rengine(std::random_device{}()),
     uniform(other.uniform),
-    strategies(other.strategies) {
+    polling(other.polling),
+    pinned(pinned_log_capacity) {
+  // nop
+}
+
+work_stealing::worker_data::worker_data(scheduler::abstract_coordinator* p)
+  : worker_data_base(p), backlog(0) {
+  // nop
+}
+
+work_stealing::worker_data::worker_data(const worker_data& other)
+  : worker_data_base(other), backlog(0) {
   // nop
 }
 
+work_stealing::poll_strategy
+work_stealing::make_poll_strategy(scheduler::abstract_coordinator* p) {
+  auto interval = CONFIG("aggressive-steal-interval", aggressive_steal_interval);
+  return {CONFIG("aggressive-poll-attempts", aggressive_poll_attempts),
+          std::max(interval, size_t{1})};
+}
+
 } // namespace caf::policy
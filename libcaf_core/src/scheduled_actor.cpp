@@ -18,6 +18,8 @@
 
 #include "caf/scheduled_actor.hpp"
 
+#include <algorithm>
+
 #include "caf/actor_ostream.hpp"
 #include "caf/actor_system_config.hpp"
 #include "caf/config.hpp"
@@ -119,12 +121,18 @@ scheduled_actor::scheduled_actor(actor_config& cfg)
     error_handler_(default_error_handler),
     down_handler_(default_down_handler),
     exit_handler_(default_exit_handler),
-    private_thread_(nullptr)
+    private_thread_(nullptr),
+    last_worker_(actor_config::no_worker),
+    msg_cost_(0),
+    pinned_worker_(actor_config::no_worker),
+    pool_(cfg.pool)
 #ifndef CAF_NO_EXCEPTIONS
     ,
     exception_handler_(default_exception_handler)
 #endif // CAF_NO_EXCEPTIONS
 {
+  if (cfg.pinned_worker != actor_config::no_worker)
+    pin_to_worker(cfg.pinned_worker);
   auto& sys_cfg = home_system().config();
   auto interval = sys_cfg.stream_tick_duration();
   CAF_ASSERT(interval.count() > 0);
@@ -160,16 +168,14 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
   switch (mailbox().push_back(std::move(ptr))) {
     case intrusive::inbox_result::unblocked_reader: {
       CAF_LOG_ACCEPT_EVENT(true);
+      count_received();
       // add a reference count to this actor and re-schedule it
       intrusive_ptr_add_ref(ctrl());
       if (getf(is_detached_flag)) {
         CAF_ASSERT(private_thread_ != nullptr);
         private_thread_->resume();
       } else {
-        if (eu != nullptr)
-          eu->exec_later(this);
-        else
-          home_system().scheduler().enqueue(this);
+        schedule(eu);
       }
       break;
     }
@@ -184,6 +190,7 @@ void scheduled_actor::enqueue(mailbox_element_ptr ptr, execution_unit* eu) {
     case intrusive::inbox_result::success:
       // enqueued to a running actors' mailbox; nothing to do
       CAF_LOG_ACCEPT_EVENT(false);
+      count_received();
       break;
   }
 }
@@ -203,6 +210,8 @@ void scheduled_actor::launch(execution_unit* eu, bool lazy, bool hide) {
   CAF_ASSERT(!getf(is_blocking_flag));
   if (!hide)
     register_at_system();
+  if (home_system().metrics_enabled())
+    metrics_ = home_system().metrics().actor_instances(name());
   if (getf(is_detached_flag)) {
     private_thread_ = new detail::private_thread(this);
     private_thread_->start();
@@ -216,7 +225,7 @@ void scheduled_actor::launch(execution_unit* eu, bool lazy, bool hide) {
   // scheduler has a reference count to the actor as long as
   // it is waiting to get scheduled
   intrusive_ptr_add_ref(ctrl());
-  eu->exec_later(this);
+  schedule(eu);
 }
 
 bool scheduled_actor::cleanup(error&& fail_state, execution_unit* host) {
@@ -243,8 +252,11 @@ bool scheduled_actor::cleanup(error&& fail_state, execution_unit* host) {
     get_normal_queue().flush_cache();
     get_urgent_queue().flush_cache();
     detail::sync_request_bouncer bounce{fail_state};
-    while (mailbox_.queue().new_round(1000, bounce).consumed_items)
-      ; // nop
+    size_t dropped = 0;
+    while (auto n = mailbox_.queue().new_round(1000, bounce).consumed_items)
+      dropped += n;
+    if (metrics_ != nullptr)
+      metrics_->mailbox_size->dec(static_cast<int64_t>(dropped));
   }
   // Dispatch to parent's `cleanup` function.
   return super::cleanup(std::move(fail_state), host);
@@ -290,8 +302,8 @@ scheduled_actor::mailbox_visitor::operator()(size_t, upstream_queue&,
   upstream_msg_visitor f{self, um};
   visit(f, um.content);
   CAF_AFTER_PROCESSING(self, invoke_message_result::consumed);
-  return ++handled_msgs < max_throughput ? intrusive::task_result::resume
-                                         : intrusive::task_result::stop_all;
+  return consumed() ? intrusive::task_result::resume
+                    : intrusive::task_result::stop_all;
 }
 
 namespace {
@@ -353,8 +365,7 @@ intrusive::task_result scheduled_actor::mailbox_visitor::operator()(
   downstream_msg_visitor f{self, qs, q, dm};
   auto res = visit(f, dm.content);
   CAF_AFTER_PROCESSING(self, invoke_message_result::consumed);
-  return ++handled_msgs < max_throughput ? res
-                                         : intrusive::task_result::stop_all;
+  return consumed() ? res : intrusive::task_result::stop_all;
 }
 
 intrusive::task_result
@@ -364,8 +375,8 @@ scheduled_actor::mailbox_visitor::operator()(mailbox_element& x) {
     case activation_result::terminated:
       return intrusive::task_result::stop;
     case activation_result::success:
-      return ++handled_msgs < max_throughput ? intrusive::task_result::resume
-                                             : intrusive::task_result::stop_all;
+      return consumed() ? intrusive::task_result::resume
+                        : intrusive::task_result::stop_all;
     case activation_result::skipped:
       return intrusive::task_result::skip;
     default:
@@ -380,6 +391,44 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
   if (!activate(ctx))
     return resumable::done;
   size_t handled_msgs = 0;
+  // Limit the time of this run if the execution unit has a resume budget. In
+  // adaptive mode, we convert the budget into a message quota as soon as we
+  // know the cost per message and read the clock only twice per run.
+  auto budget = ctx->resume_budget();
+  auto adaptive = budget > 0 && ctx->adaptive_resume_budget();
+  uint64_t start = 0;
+  uint64_t deadline = 0;
+  if (budget > 0) {
+    start = detail::tsc_clock::now();
+    if (adaptive && msg_cost_ > 0) {
+      auto quota = std::max(budget / msg_cost_, uint64_t{1});
+      if (quota < max_throughput)
+        max_throughput = static_cast<size_t>(quota);
+    } else {
+      deadline = start + budget;
+    }
+  }
+  // Number of messages that we have already reported to the metrics.
+  size_t reported_msgs = 0;
+  auto update_stats = [&] {
+    if (handled_msgs == reported_msgs)
+      return;
+    if (metrics_ != nullptr) {
+      auto n = static_cast<int64_t>(handled_msgs - reported_msgs);
+      metrics_->processed->inc(n);
+      metrics_->mailbox_size->dec(n);
+    }
+    reported_msgs = handled_msgs;
+    if (!adaptive)
+      return;
+    auto sample = (detail::tsc_clock::now() - start) / handled_msgs;
+    // Exponentially weighted moving average, giving each sample 1/8 weight.
+    if (msg_cost_ == 0)
+      msg_cost_ = sample;
+    else
+      msg_cost_ = msg_cost_ - msg_cost_ / 8 + sample / 8;
+    msg_cost_ = std::max(msg_cost_, uint64_t{1});
+  };
   actor_clock::time_point tout{actor_clock::duration_type{0}};
   auto reset_timeouts_if_needed = [&] {
     // Set a new receive timeout if we called our behavior at least once.
@@ -393,20 +442,22 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
       set_stream_timeout(tout);
     }
   };
-  mailbox_visitor f{this, handled_msgs, max_throughput};
+  mailbox_visitor f{this, handled_msgs, max_throughput, deadline};
   mailbox_element_ptr ptr;
   // Timeout for calling `advance_streams`.
-  while (handled_msgs < max_throughput) {
+  while (handled_msgs < max_throughput && !f.out_of_time()) {
     CAF_LOG_DEBUG("start new DRR round");
     // TODO: maybe replace '3' with configurable / adaptive value?
     // Dispatch on the different message categories in our mailbox.
     if (!mailbox_.new_round(3, f).consumed_items) {
+      update_stats();
       reset_timeouts_if_needed();
       if (mailbox().try_block())
         return resumable::awaiting_message;
     }
     // Check whether the visitor left the actor without behavior.
     if (finalize()) {
+      update_stats();
       return resumable::done;
     }
     // Advance streams, i.e., try to generating credit or to emit batches.
@@ -414,7 +465,8 @@ resumable::resume_result scheduled_actor::resume(execution_unit* ctx,
     if (now >= tout)
       tout = advance_streams(now);
   }
-  CAF_LOG_DEBUG("max throughput reached");
+  CAF_LOG_DEBUG("max throughput or resume time reached");
+  update_stats();
   reset_timeouts_if_needed();
   if (mailbox().try_block())
     return resumable::awaiting_message;
@@ -428,6 +480,34 @@ proxy_registry* scheduled_actor::proxy_registry_ptr() {
   return nullptr;
 }
 
+void scheduled_actor::schedule(execution_unit* eu) {
+  // Units of the default scheduler and units outside of the scheduler (e.g.,
+  // multiplexers) return `nullptr` as their pool. This preserves the regular
+  // dispatching for actors in the default scheduler.
+  if (eu != nullptr && eu->pool() == pool_)
+    eu->exec_later(this);
+  else if (pool_ != nullptr)
+    pool_->enqueue(this);
+  else
+    home_system().scheduler().enqueue(this);
+}
+
+// -- scheduler hints ----------------------------------------------------------
+
+bool scheduled_actor::pin_to_worker(size_t id) noexcept {
+  if (id != actor_config::no_worker) {
+    auto sched = pool_ != nullptr ? pool_ : &home_system().scheduler();
+    if (id >= sched->num_workers()) {
+      CAF_LOG_WARNING("cannot pin actor to a non-existing worker:"
+                      << CAF_ARG(id)
+                      << CAF_ARG2("num_workers", sched->num_workers()));
+      return false;
+    }
+  }
+  pinned_worker_.store(id, std::memory_order_relaxed);
+  return true;
+}
+
 // -- state modifiers ----------------------------------------------------------
 
 void scheduled_actor::quit(error x) {
@@ -233,12 +233,24 @@ const actor_system_config& abstract_coordinator::config() const {
   return system_.config();
 }
 
+void abstract_coordinator::enqueue_batch(span<resumable*> jobs) {
+  for (auto job : jobs)
+    enqueue(job);
+}
+
 bool abstract_coordinator::detaches_utility_actors() const {
   return true;
 }
 
+void abstract_coordinator::pool_name(std::string name) {
+  pool_name_ = std::move(name);
+}
+
 void abstract_coordinator::start() {
   CAF_LOG_TRACE("");
+  // utility actors always run in the default scheduler
+  if (is_pool())
+    return;
   // launch utility actors
   static constexpr auto fs = hidden + detached;
   utility_actors_[printer_id] = system_.spawn<printer_actor, fs>();
@@ -247,7 +259,27 @@ void abstract_coordinator::start() {
 void abstract_coordinator::init(actor_system_config& cfg) {
   namespace sr = defaults::scheduler;
   max_throughput_ = get_or(cfg, "scheduler.max-throughput", sr::max_throughput);
+  max_resume_time_ = get_or(cfg, "scheduler.max-resume-time",
+                            sr::max_resume_time);
+  adaptive_resume_time_ = get_or(cfg, "scheduler.adaptive-resume-time",
+                                 sr::adaptive_resume_time);
   num_workers_ = get_or(cfg, "scheduler.max-threads", sr::max_threads);
+  pin_workers_ = get_or(cfg, "scheduler.affinity", sr::affinity);
+  numa_aware_ = get_or(cfg, "scheduler.numa-aware", sr::numa_aware);
+  clock_type_ = get_or(cfg, "scheduler.clock", sr::clock);
+  clock_resolution_ = get_or(cfg, "scheduler.clock-resolution",
+                             sr::clock_resolution);
+  if (is_pool()) {
+    auto prefix = "scheduler.pools." + pool_name_ + '.';
+    max_throughput_ = get_or(cfg, prefix + "max-throughput", max_throughput_);
+    max_resume_time_ = get_or(cfg, prefix + "max-resume-time",
+                              max_resume_time_);
+    adaptive_resume_time_ = get_or(cfg, prefix + "adaptive-resume-time",
+                                   adaptive_resume_time_);
+    num_workers_ = get_or(cfg, prefix + "max-threads", num_workers_);
+    pin_workers_ = get_or(cfg, prefix + "affinity", pin_workers_);
+    numa_aware_ = get_or(cfg, prefix + "numa-aware", numa_aware_);
+  }
 }
 
 actor_system::module::id_t abstract_coordinator::id() const {
@@ -260,6 +292,8 @@ void* abstract_coordinator::subtype_ptr() {
 
 void abstract_coordinator::stop_actors() {
   CAF_LOG_TRACE("");
+  if (is_pool())
+    return;
   scoped_actor self{system_, true};
   for (auto& x : utility_actors_)
     anon_send_exit(x, exit_reason::user_shutdown);
@@ -267,7 +301,16 @@ void abstract_coordinator::stop_actors() {
 }
 
 abstract_coordinator::abstract_coordinator(actor_system& sys)
-  : next_worker_(0), max_throughput_(0), num_workers_(0), system_(sys) {
+  : next_worker_(0),
+    max_throughput_(0),
+    max_resume_time_(0),
+    adaptive_resume_time_(false),
+    num_workers_(0),
+    pin_workers_(false),
+    numa_aware_(false),
+    clock_type_(atom("simple")),
+    clock_resolution_(0),
+    system_(sys) {
   // nop
 }
 
@@ -0,0 +1,70 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/telemetry/histogram.hpp"
+
+#include <algorithm>
+
+namespace caf::telemetry {
+
+histogram::histogram(std::vector<double> upper_bounds)
+  : upper_bounds_(std::move(upper_bounds)) {
+  auto n = upper_bounds_.size() + 1;
+  for (auto& x : shards_) {
+    x.counts.reset(new std::atomic<int64_t>[n]);
+    for (size_t i = 0; i < n; ++i)
+      x.counts[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void histogram::observe(double value) noexcept {
+  auto i = std::lower_bound(upper_bounds_.begin(), upper_bounds_.end(), value);
+  auto& x = shards_[this_shard()];
+  x.counts[static_cast<size_t>(i - upper_bounds_.begin())].fetch_add(
+    1, std::memory_order_relaxed);
+  // C++17 has no fetch_add for atomic floating point numbers.
+  auto sum = x.sum.load(std::memory_order_relaxed);
+  while (!x.sum.compare_exchange_weak(sum, sum + value,
+                                      std::memory_order_relaxed))
+    ; // nop
+}
+
+std::vector<int64_t> histogram::bucket_counts() const {
+  std::vector<int64_t> result(upper_bounds_.size() + 1);
+  for (auto& x : shards_)
+    for (size_t i = 0; i < result.size(); ++i)
+      result[i] += x.counts[i].load(std::memory_order_relaxed);
+  return result;
+}
+
+double histogram::sum() const noexcept {
+  double result = 0.;
+  for (auto& x : shards_)
+    result += x.sum.load(std::memory_order_relaxed);
+  return result;
+}
+
+int64_t histogram::count() const noexcept {
+  int64_t result = 0;
+  for (auto& x : shards_)
+    for (size_t i = 0; i <= upper_bounds_.size(); ++i)
+      result += x.counts[i].load(std::memory_order_relaxed);
+  return result;
+}
+
+} // namespace caf::telemetry
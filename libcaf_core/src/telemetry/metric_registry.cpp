@@ -0,0 +1,259 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/telemetry/metric_registry.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+
+#include "caf/raise_error.hpp"
+
+namespace caf::telemetry {
+
+namespace {
+
+// Upper bounds for the park time of workers in seconds.
+const std::vector<double> park_time_buckets{0.0001, 0.001, 0.01, 0.1, 1., 10.};
+
+std::string to_std_string(string_view x) {
+  return std::string{x.begin(), x.end()};
+}
+
+void append_escaped(std::string& out, string_view x, bool escape_quotes) {
+  for (auto c : x) {
+    switch (c) {
+      case '\\':
+        out += "\\\\";
+        break;
+      case '\n':
+        out += "\\n";
+        break;
+      case '"':
+        if (escape_quotes)
+          out += "\\\"";
+        else
+          out += c;
+        break;
+      default:
+        out += c;
+    }
+  }
+}
+
+void append_double(std::string& out, double x) {
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%.12g", x);
+  out += buf;
+}
+
+// Renders `labels` as `key="value",...` without surrounding braces.
+std::string render(const label_list& labels) {
+  std::string result;
+  for (auto& kvp : labels) {
+    if (!result.empty())
+      result += ',';
+    result += kvp.first;
+    result += "=\"";
+    append_escaped(result, kvp.second, true);
+    result += '"';
+  }
+  return result;
+}
+
+// Appends `name{labels}` or just `name` if there are no labels.
+void append_name(std::string& out, const std::string& name,
+                 const std::string& labels) {
+  out += name;
+  if (!labels.empty()) {
+    out += '{';
+    out += labels;
+    out += '}';
+  }
+}
+
+void append_value(std::string& out, int64_t value) {
+  out += ' ';
+  out += std::to_string(value);
+  out += '\n';
+}
+
+} // namespace
+
+metric_registry::metric_registry() {
+  // nop
+}
+
+metric_registry::~metric_registry() {
+  // nop
+}
+
+counter* metric_registry::counter_instance(string_view name,
+                                           const label_list& labels,
+                                           string_view helptext) {
+  std::unique_lock<std::mutex> guard{mtx_};
+  auto& instances = get_family(name, metric_type::counter, helptext).counters;
+  auto& ptr = instances[render(labels)];
+  if (ptr == nullptr)
+    ptr.reset(new counter);
+  return ptr.get();
+}
+
+gauge* metric_registry::gauge_instance(string_view name,
+                                       const label_list& labels,
+                                       string_view helptext) {
+  std::unique_lock<std::mutex> guard{mtx_};
+  auto& instances = get_family(name, metric_type::gauge, helptext).gauges;
+  auto& ptr = instances[render(labels)];
+  if (ptr == nullptr)
+    ptr.reset(new gauge);
+  return ptr.get();
+}
+
+histogram*
+metric_registry::histogram_instance(string_view name, const label_list& labels,
+                                    string_view helptext,
+                                    std::vector<double> upper_bounds) {
+  std::unique_lock<std::mutex> guard{mtx_};
+  auto& instances = get_family(name, metric_type::histogram, helptext)
+                      .histograms;
+  auto& ptr = instances[render(labels)];
+  if (ptr == nullptr)
+    ptr.reset(new histogram(std::move(upper_bounds)));
+  return ptr.get();
+}
+
+actor_metrics* metric_registry::actor_instances(string_view name) {
+  auto key = to_std_string(name);
+  {
+    std::unique_lock<std::mutex> guard{mtx_};
+    auto i = actor_metrics_.find(key);
+    if (i != actor_metrics_.end())
+      return i->second.get();
+  }
+  label_list labels{{"name", key}};
+  std::unique_ptr<actor_metrics> ptr{new actor_metrics};
+  ptr->received = counter_instance("caf_actor_messages_received_total", labels,
+                                   "Messages that arrived in the mailbox.");
+  ptr->processed = counter_instance("caf_actor_messages_processed_total",
+                                    labels, "Messages that actors consumed.");
+  ptr->sent = counter_instance("caf_actor_messages_sent_total", labels,
+                               "Messages that actors sent.");
+  ptr->mailbox_size = gauge_instance("caf_actor_mailbox_size", labels,
+                                     "Messages that wait in the mailbox.");
+  std::unique_lock<std::mutex> guard{mtx_};
+  // Another thread may have created the same entry in the meantime. All of
+  // its members point to the same instances as ours.
+  auto& entry = actor_metrics_[key];
+  if (entry == nullptr)
+    entry = std::move(ptr);
+  return entry.get();
+}
+
+worker_metrics metric_registry::worker_instances(string_view pool,
+                                                 size_t id) {
+  label_list labels{{"pool", to_std_string(pool)},
+                    {"worker", std::to_string(id)}};
+  worker_metrics result;
+  result.resumed_jobs = counter_instance("caf_scheduler_resumed_jobs_total",
+                                         labels, "Jobs that workers resumed.");
+  result.steals = counter_instance("caf_scheduler_steals_total", labels,
+                                   "Jobs that workers stole from others.");
+  result.park_time = histogram_instance(
+    "caf_scheduler_park_seconds", labels,
+    "Time that workers blocked while waiting for jobs.", park_time_buckets);
+  return result;
+}
+
+std::string metric_registry::to_prometheus() const {
+  std::string result;
+  std::unique_lock<std::mutex> guard{mtx_};
+  for (auto& kvp : families_) {
+    auto& name = kvp.first;
+    auto& fam = kvp.second;
+    result += "# HELP ";
+    result += name;
+    result += ' ';
+    append_escaped(result, fam.helptext, false);
+    result += "\n# TYPE ";
+    result += name;
+    switch (fam.type) {
+      case metric_type::counter:
+        result += " counter\n";
+        for (auto& instance : fam.counters) {
+          append_name(result, name, instance.first);
+          append_value(result, instance.second->value());
+        }
+        break;
+      case metric_type::gauge:
+        result += " gauge\n";
+        for (auto& instance : fam.gauges) {
+          append_name(result, name, instance.first);
+          append_value(result, instance.second->value());
+        }
+        break;
+      case metric_type::histogram:
+        result += " histogram\n";
+        for (auto& instance : fam.histograms) {
+          auto& labels = instance.first;
+          auto& hist = *instance.second;
+          auto& bounds = hist.upper_bounds();
+          auto counts = hist.bucket_counts();
+          auto prefix = labels.empty() ? labels : labels + ',';
+          int64_t total = 0;
+          for (size_t i = 0; i < counts.size(); ++i) {
+            total += counts[i];
+            result += name;
+            result += "_bucket{";
+            result += prefix;
+            result += "le=\"";
+            if (i < bounds.size())
+              append_double(result, bounds[i]);
+            else
+              result += "+Inf";
+            result += "\"}";
+            append_value(result, total);
+          }
+          append_name(result, name + "_sum", labels);
+          result += ' ';
+          append_double(result, hist.sum());
+          result += '\n';
+          append_name(result, name + "_count", labels);
+          append_value(result, total);
+        }
+    }
+  }
+  return result;
+}
+
+metric_registry::family& metric_registry::get_family(string_view name,
+                                                     metric_type type,
+                                                     string_view helptext) {
+  auto key = to_std_string(name);
+  auto i = families_.find(key);
+  if (i == families_.end()) {
+    family fam;
+    fam.type = type;
+    fam.helptext = to_std_string(helptext);
+    i = families_.emplace(std::move(key), std::move(fam)).first;
+  } else if (i->second.type != type) {
+    CAF_RAISE_ERROR(std::logic_error, "metric family has a different type");
+  }
+  return i->second;
+}
+
+} // namespace caf::telemetry
@@ -38,6 +38,8 @@ using namespace std;
 using hi_atom = atom_constant<atom("hi")>;
 using ho_atom = atom_constant<atom("ho")>;
 
+using hey_atom = atom_constant<atom("hey")>;
+
 namespace {
 
 class nocopy_fun {
@@ -98,6 +100,33 @@ CAF_TEST(multiple_lambda_construct) {
   CAF_CHECK_EQUAL(f(m3), none);
 }
 
+CAF_TEST(large behaviors preserve first-match semantics) {
+  behavior f{
+    [](hi_atom, int x) { return x; },
+    [](atom_value, int x) { return x * 100; },
+    [](ho_atom, int x) { return x * 10; },
+    [](hey_atom) { return 1; },
+    [](ho_atom) { return 2; },
+    [](int x) { return x + 1; },
+    [](int x, int y) { return x * y; },
+    [](const std::string& x) { return x; },
+    [](double) { return skip(); },
+    [](double x) { return x; },
+  };
+  auto run = [&](message x) { return f(x); };
+  CAF_CHECK_EQUAL(to_string(run(make_message(hi_atom::value, 2))), "*(2)");
+  CAF_CHECK_EQUAL(to_string(run(make_message(ho_atom::value, 2))), "*(200)");
+  CAF_CHECK_EQUAL(to_string(run(make_message(atom("foo"), 2))), "*(200)");
+  CAF_CHECK_EQUAL(to_string(run(make_message(hey_atom::value))), "*(1)");
+  CAF_CHECK_EQUAL(to_string(run(make_message(ho_atom::value))), "*(2)");
+  CAF_CHECK_EQUAL(run(make_message(atom("foo"))), none);
+  CAF_CHECK_EQUAL(to_string(run(m1)), "*(2)");
+  CAF_CHECK_EQUAL(to_string(run(m2)), "*(2)");
+  CAF_CHECK_EQUAL(run(m3), none);
+  CAF_CHECK_EQUAL(to_string(run(make_message("hello"s))), R"__(*("hello"))__");
+  CAF_CHECK_EQUAL(run(make_message(1.)), none);
+}
+
 CAF_TEST(become_empty_behavior) {
   actor_system_config cfg{};
   actor_system sys{cfg};
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.cpu_topology
+
+#include "caf/detail/cpu_topology.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <vector>
+
+#ifdef CAF_LINUX
+#  include <sched.h>
+#endif // CAF_LINUX
+
+using namespace caf;
+
+using detail::cpu_info;
+using detail::cpu_topology;
+
+namespace {
+
+using ids = std::vector<size_t>;
+
+// Two NUMA nodes with two L3 groups each. Every L3 group has two physical
+// cores with two hardware threads.
+cpu_topology make_dual_socket() {
+  std::vector<cpu_info> cpus;
+  for (size_t id = 0; id < 16; ++id) {
+    auto core = id % 8;
+    auto node = core / 4;
+    auto cache_group = core / 2;
+    cpus.emplace_back(cpu_info{id, core, node, node, cache_group, id / 8});
+  }
+  return cpu_topology{std::move(cpus)};
+}
+
+} // namespace
+
+CAF_TEST(parsing CPU lists) {
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list("0"), ids({0}));
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list("0-3"), ids({0, 1, 2, 3}));
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list("0-1,4,6-7\n"),
+                  ids({0, 1, 4, 6, 7}));
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list(""), ids());
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list("3-1"), ids());
+  CAF_CHECK_EQUAL(cpu_topology::parse_cpu_list("a-b"), ids());
+}
+
+CAF_TEST(detection always finds at least one CPU) {
+  auto topology = cpu_topology::detect();
+  CAF_CHECK(!topology.cpus().empty());
+}
+
+#ifdef CAF_LINUX
+
+CAF_TEST(detection respects the affinity mask of the process) {
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CAF_REQUIRE_EQUAL(sched_getaffinity(0, sizeof(cpu_set_t), &mask), 0);
+  auto topology = cpu_topology::detect();
+  CAF_CHECK_LESS_OR_EQUAL(topology.cpus().size(),
+                          static_cast<size_t>(CPU_COUNT(&mask)));
+  for (auto& cpu : topology.cpus())
+    CAF_CHECK(cpu.id < CPU_SETSIZE && CPU_ISSET(cpu.id, &mask));
+}
+
+#endif // CAF_LINUX
+
+CAF_TEST(placement prefers physical cores over SMT siblings) {
+  auto placement = make_dual_socket().place(8);
+  CAF_REQUIRE_EQUAL(placement.cpus.size(), 8u);
+  ids cpus;
+  for (auto& cpu : placement.cpus)
+    cpus.emplace_back(cpu.id);
+  CAF_CHECK_EQUAL(cpus, ids({0, 1, 2, 3, 4, 5, 6, 7}));
+}
+
+CAF_TEST(placement wraps around when oversubscribing) {
+  auto placement = make_dual_socket().place(20);
+  CAF_REQUIRE_EQUAL(placement.cpus.size(), 20u);
+  CAF_CHECK_EQUAL(placement.cpus[8].id, 8u);
+  CAF_CHECK_EQUAL(placement.cpus[16].id, 0u);
+}
+
+CAF_TEST(steal tiers group victims by distance) {
+  auto placement = make_dual_socket().place(8);
+  CAF_REQUIRE_EQUAL(placement.steal_tiers.size(), 8u);
+  auto& tiers = placement.steal_tiers[0];
+  CAF_REQUIRE_EQUAL(tiers.size(), 3u);
+  CAF_CHECK_EQUAL(tiers[0], ids({1}));
+  CAF_CHECK_EQUAL(tiers[1], ids({2, 3}));
+  CAF_CHECK_EQUAL(tiers[2], ids({4, 5, 6, 7}));
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.mpmc_ring_queue
+
+#include "caf/detail/mpmc_ring_queue.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <algorithm>
+#include <array>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using int_queue = detail::mpmc_ring_queue<int>;
+
+struct fixture {
+  fixture() : queue(2) {
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<int>(i);
+  }
+
+  int_queue queue;
+  std::array<int, 300> values;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(mpmc_ring_queue_tests, fixture)
+
+CAF_TEST(default constructed queues are empty) {
+  CAF_CHECK(queue.empty());
+  CAF_CHECK_EQUAL(queue.size(), 0u);
+  CAF_CHECK_EQUAL(queue.capacity(), 4u);
+  CAF_CHECK_EQUAL(queue.try_pop(), nullptr);
+}
+
+CAF_TEST(queues are FIFO until the ring overflows) {
+  for (int i = 0; i < 4; ++i)
+    CAF_CHECK(queue.try_push(&values[i]));
+  CAF_CHECK(!queue.try_push(&values[4]));
+  for (int i = 0; i < 4; ++i)
+    CAF_CHECK_EQUAL(*queue.try_pop(), i);
+  CAF_CHECK(queue.empty());
+}
+
+CAF_TEST(push falls back to the overflow list) {
+  for (int i = 0; i < 6; ++i)
+    queue.push(&values[i]);
+  CAF_CHECK_EQUAL(queue.size(), 6u);
+  for (int i = 0; i < 6; ++i)
+    CAF_CHECK_EQUAL(*queue.try_pop(), i);
+  CAF_CHECK(queue.empty());
+  CAF_CHECK_EQUAL(queue.try_pop(), nullptr);
+}
+
+CAF_TEST(concurrent access) {
+  auto producer = [&](size_t first, size_t last) {
+    for (auto i = first; i != last; ++i)
+      queue.push(&values[i]);
+  };
+  std::vector<std::thread> producers;
+  producers.emplace_back(producer, 0, 100);
+  producers.emplace_back(producer, 100, 200);
+  producers.emplace_back(producer, 200, 300);
+  std::vector<int> result;
+  while (result.size() < values.size())
+    if (auto ptr = queue.try_pop())
+      result.push_back(*ptr);
+  for (auto& t : producers)
+    t.join();
+  std::sort(result.begin(), result.end());
+  CAF_CHECK(std::equal(result.begin(), result.end(), values.begin()));
+  CAF_CHECK(queue.empty());
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,82 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.parking_lot
+
+#include "caf/detail/parking_lot.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <atomic>
+#include <thread>
+
+using namespace caf;
+
+namespace {
+
+struct fixture {
+  detail::parking_lot lot;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(parking_lot_tests, fixture)
+
+CAF_TEST(unparking without waiters is a no-op) {
+  lot.unpark_one();
+  lot.unpark_all();
+  CAF_CHECK_EQUAL(lot.num_waiters(), 0u);
+  CAF_CHECK_EQUAL(lot.num_parks(), 0u);
+  CAF_CHECK_EQUAL(lot.num_unparks(), 0u);
+}
+
+CAF_TEST(canceling a park removes the waiter) {
+  lot.prepare_park();
+  CAF_CHECK_EQUAL(lot.num_waiters(), 1u);
+  lot.cancel_park();
+  CAF_CHECK_EQUAL(lot.num_waiters(), 0u);
+}
+
+CAF_TEST(park returns immediately after an unpark since prepare_park) {
+  auto key = lot.prepare_park();
+  lot.unpark_one();
+  lot.park(key);
+  CAF_CHECK_EQUAL(lot.num_waiters(), 0u);
+  CAF_CHECK_EQUAL(lot.num_parks(), 1u);
+  CAF_CHECK_EQUAL(lot.num_unparks(), 1u);
+}
+
+CAF_TEST(producers wake up parked consumers) {
+  std::atomic<int> item{0};
+  std::thread consumer{[&] {
+    for (;;) {
+      auto key = lot.prepare_park();
+      if (item.load() != 0) {
+        lot.cancel_park();
+        return;
+      }
+      lot.park(key);
+    }
+  }};
+  item = 42;
+  lot.unpark_all();
+  consumer.join();
+  CAF_CHECK_EQUAL(lot.num_waiters(), 0u);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,118 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.private_thread_pool
+
+#include "caf/detail/private_thread_pool.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+#include "caf/blocking_actor.hpp"
+#include "caf/event_based_actor.hpp"
+
+using namespace caf;
+
+namespace {
+
+using job_type = detail::private_thread_pool::job_type;
+
+struct config : actor_system_config {
+  explicit config(size_t max_cached_threads) {
+    set("scheduler.max-cached-threads", max_cached_threads);
+    set("scheduler.cached-thread-timeout", timespan{std::chrono::seconds(30)});
+  }
+};
+
+// Waits until `n` threads of `pool` became idle.
+bool await_idle(detail::private_thread_pool& pool, size_t n) {
+  for (int i = 0; i < 10000; ++i) {
+    if (pool.stats().idle_threads == n)
+      return true;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return false;
+}
+
+} // namespace
+
+CAF_TEST(detached actors reuse idle threads) {
+  config cfg{8};
+  actor_system sys{cfg};
+  auto& pool = sys.private_threads();
+  for (int i = 0; i < 3; ++i) {
+    sys.spawn<detached>([] {});
+    CAF_REQUIRE(await_idle(pool, 1));
+  }
+  auto stats = pool.stats();
+  CAF_CHECK_EQUAL(stats.threads_created, 1u);
+  CAF_CHECK_EQUAL(stats.jobs_started, 3u);
+}
+
+CAF_TEST(blocking actors reuse idle threads) {
+  config cfg{8};
+  actor_system sys{cfg};
+  auto& pool = sys.private_threads();
+  for (int i = 0; i < 3; ++i) {
+    sys.spawn([](blocking_actor*) {});
+    CAF_REQUIRE(await_idle(pool, 1));
+  }
+  auto stats = pool.stats();
+  CAF_CHECK_EQUAL(stats.threads_created, 1u);
+  CAF_CHECK_EQUAL(stats.jobs_started, 3u);
+}
+
+CAF_TEST(a pool without cache starts one thread per job) {
+  config cfg{0};
+  actor_system sys{cfg};
+  auto& pool = sys.private_threads();
+  std::atomic<int> done{0};
+  for (int i = 0; i < 3; ++i) {
+    pool.run(job_type{[&done] { ++done; }});
+    while (done.load() != i + 1)
+      std::this_thread::yield();
+  }
+  auto stats = pool.stats();
+  CAF_CHECK_EQUAL(stats.threads_created, 3u);
+  CAF_CHECK_EQUAL(stats.jobs_started, 3u);
+  CAF_CHECK_EQUAL(stats.idle_threads, 0u);
+}
+
+CAF_TEST(concurrent jobs run in separate threads) {
+  config cfg{8};
+  actor_system sys{cfg};
+  auto& pool = sys.private_threads();
+  std::atomic<int> started{0};
+  std::atomic<bool> release{false};
+  for (int i = 0; i < 2; ++i)
+    pool.run(job_type{[&] {
+      ++started;
+      while (!release.load())
+        std::this_thread::yield();
+    }});
+  while (started.load() != 2)
+    std::this_thread::yield();
+  release = true;
+  CAF_REQUIRE(await_idle(pool, 2));
+  CAF_CHECK_EQUAL(pool.stats().threads_created, 2u);
+}
@@ -0,0 +1,132 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+#define CAF_SUITE detail.slab_pool
+
+#include "caf/detail/slab_pool.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/actor_system_config.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+using detail::slab_pool;
+
+namespace {
+
+struct fixture {
+  fixture() : before(slab_pool::stats()) {
+    slab_pool::enable(true);
+  }
+
+  slab_pool::statistics delta() {
+    auto now = slab_pool::stats();
+    now.hits -= before.hits;
+    now.misses -= before.misses;
+    now.bypassed -= before.bypassed;
+    now.remote_releases -= before.remote_releases;
+    return now;
+  }
+
+  slab_pool::statistics before;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(slab_pool_tests, fixture)
+
+CAF_TEST(released blocks are reused by the same thread) {
+  auto x = slab_pool::allocate(40);
+  slab_pool::deallocate(x);
+  auto y = slab_pool::allocate(40);
+  CAF_CHECK_EQUAL(x, y);
+  slab_pool::deallocate(y);
+  CAF_CHECK_GREATER_OR_EQUAL(delta().hits, 1u);
+}
+
+CAF_TEST(blocks of different size classes are not mixed) {
+  auto x = slab_pool::allocate(20);
+  slab_pool::deallocate(x);
+  auto y = slab_pool::allocate(200);
+  CAF_CHECK_NOT_EQUAL(x, y);
+  slab_pool::deallocate(y);
+}
+
+CAF_TEST(large allocations bypass the pool) {
+  auto x = slab_pool::allocate(slab_pool::max_block_size);
+  slab_pool::deallocate(x);
+  CAF_CHECK_EQUAL(delta().bypassed, 1u);
+}
+
+CAF_TEST(disabling the pool bypasses free lists) {
+  auto x = slab_pool::allocate(40);
+  slab_pool::enable(false);
+  auto y = slab_pool::allocate(40);
+  slab_pool::deallocate(x);
+  slab_pool::enable(true);
+  slab_pool::deallocate(y);
+  CAF_CHECK_EQUAL(delta().bypassed, 1u);
+}
+
+CAF_TEST(blocks released by other threads return to their owner) {
+  constexpr size_t num_blocks = 100;
+  std::vector<void*> blocks;
+  for (size_t i = 0; i < num_blocks; ++i)
+    blocks.emplace_back(slab_pool::allocate(100));
+  std::thread t{[&] {
+    for (auto ptr : blocks)
+      slab_pool::deallocate(ptr);
+  }};
+  t.join();
+  CAF_CHECK_EQUAL(delta().remote_releases, num_blocks);
+  auto hits_before = delta().hits;
+  for (auto& ptr : blocks)
+    ptr = slab_pool::allocate(100);
+  CAF_CHECK_EQUAL(delta().hits - hits_before, num_blocks);
+  for (auto ptr : blocks)
+    slab_pool::deallocate(ptr);
+}
+
+CAF_TEST(memory is writable up to the requested size) {
+  for (size_t n = 1; n <= slab_pool::max_block_size * 2; n *= 2) {
+    auto ptr = static_cast<char*>(slab_pool::allocate(n));
+    std::fill(ptr, ptr + n, 'x');
+    CAF_CHECK_EQUAL(ptr[n - 1], 'x');
+    slab_pool::deallocate(ptr);
+  }
+}
+
+CAF_TEST(only the first actor system configures the pool) {
+  actor_system_config cfg1;
+  actor_system sys1{cfg1};
+  actor_system_config cfg2;
+  put(cfg2.content, "memory.enable-pooling", false);
+  actor_system sys2{cfg2};
+  CAF_CHECK(slab_pool::enabled());
+  auto before = sys2.memory_pool_stats();
+  slab_pool::deallocate(slab_pool::allocate(40));
+  auto after = sys2.memory_pool_stats();
+  CAF_CHECK_GREATER(after.hits + after.misses, before.hits + before.misses);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,178 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.timer_wheel_actor_clock
+
+#include "caf/detail/timer_wheel_actor_clock.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <chrono>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using clock_type = detail::timer_wheel_actor_clock;
+
+struct testee_state {
+  uint64_t timeout_id = 41;
+};
+
+behavior testee(stateful_actor<testee_state>* self, clock_type* t) {
+  return {
+    [=](ok_atom, timespan delay) {
+      self->state.timeout_id += 1;
+      t->set_ordinary_timeout(t->now() + delay, self, atom(""),
+                              self->state.timeout_id);
+    },
+    [=](add_atom, timespan delay) {
+      self->state.timeout_id += 1;
+      t->set_multi_timeout(t->now() + delay, self, atom(""),
+                           self->state.timeout_id);
+    },
+    [=](put_atom, timespan delay) {
+      self->state.timeout_id += 1;
+      auto mid = make_message_id(self->state.timeout_id).response_id();
+      t->set_request_timeout(t->now() + delay, self, mid);
+    },
+    [=](delete_atom) {
+      auto mid = make_message_id(self->state.timeout_id).response_id();
+      t->cancel_request_timeout(self, mid);
+    },
+    [=](leave_atom) { t->cancel_timeouts(self); },
+    [](const timeout_msg&) {
+      // nop
+    },
+    [](const error&) {
+      // nop
+    },
+    [](const std::string&) {
+      // nop
+    },
+  };
+}
+
+struct fixture : test_coordinator_fixture<> {
+  clock_type t{4, 1ms};
+  actor aut;
+
+  fixture() : aut(sys.spawn(testee, &t)) {
+    // nop
+  }
+
+  size_t trigger(timespan delay) {
+    return t.trigger_expired_timeouts(t.now() + delay);
+  }
+};
+
+struct tid {
+  uint32_t value;
+};
+
+inline bool operator==(const timeout_msg& x, const tid& y) {
+  return x.timeout_id == y.value;
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(timer_wheel_actor_clock_tests, fixture)
+
+CAF_TEST(timeouts trigger after their delay) {
+  self->send(aut, ok_atom::value, timespan{10s});
+  expect((ok_atom, timespan), from(self).to(aut).with(_, _));
+  CAF_CHECK_EQUAL(t.num_pending(), 1u);
+  CAF_CHECK_EQUAL(trigger(5s), 0u);
+  CAF_CHECK_EQUAL(trigger(20s), 1u);
+  CAF_CHECK_EQUAL(t.num_pending(), 0u);
+  expect((timeout_msg), from(aut).to(aut).with(tid{42}));
+}
+
+CAF_TEST(ordinary timeouts override previous ones) {
+  self->send(aut, ok_atom::value, timespan{10s});
+  expect((ok_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, ok_atom::value, timespan{10s});
+  expect((ok_atom, timespan), from(self).to(aut).with(_, _));
+  CAF_CHECK_EQUAL(trigger(20s), 1u);
+  expect((timeout_msg), from(aut).to(aut).with(tid{43}));
+  disallow((timeout_msg), from(aut).to(aut));
+}
+
+CAF_TEST(multi timeouts trigger independently) {
+  self->send(aut, add_atom::value, timespan{10s});
+  expect((add_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, add_atom::value, timespan{100ms});
+  expect((add_atom, timespan), from(self).to(aut).with(_, _));
+  CAF_CHECK_EQUAL(t.num_pending(), 2u);
+  CAF_CHECK_EQUAL(trigger(1s), 1u);
+  expect((timeout_msg), from(aut).to(aut).with(tid{43}));
+  CAF_CHECK_EQUAL(trigger(20s), 1u);
+  expect((timeout_msg), from(aut).to(aut).with(tid{42}));
+}
+
+CAF_TEST(request timeouts are cancellable) {
+  self->send(aut, put_atom::value, timespan{10s});
+  expect((put_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, delete_atom::value);
+  expect((delete_atom), from(self).to(aut).with(_));
+  CAF_CHECK_EQUAL(trigger(20s), 0u);
+  CAF_CHECK_EQUAL(t.num_pending(), 0u);
+  disallow((error), from(aut).to(aut));
+}
+
+CAF_TEST(cancel timeouts drops all timeouts of an actor) {
+  self->send(aut, ok_atom::value, timespan{10s});
+  expect((ok_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, add_atom::value, timespan{10s});
+  expect((add_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, put_atom::value, timespan{10s});
+  expect((put_atom, timespan), from(self).to(aut).with(_, _));
+  self->send(aut, leave_atom::value);
+  expect((leave_atom), from(self).to(aut).with(_));
+  CAF_CHECK_EQUAL(trigger(20s), 0u);
+  CAF_CHECK_EQUAL(t.num_pending(), 0u);
+}
+
+CAF_TEST(delayed messages arrive after their delay) {
+  t.schedule_message(t.now() + 1s, actor_cast<strong_actor_ptr>(aut),
+                     make_mailbox_element(nullptr, make_message_id(), {},
+                                          "foo"));
+  CAF_CHECK_EQUAL(trigger(0s), 0u);
+  CAF_CHECK_EQUAL(trigger(2s), 1u);
+  expect((std::string), to(aut).with("foo"));
+}
+
+CAF_TEST(timeouts beyond the range of the wheel wrap around) {
+  // With 1us ticks, the last level of the wheel covers about 16.7s.
+  clock_type fine_clock{1, 1us};
+  fine_clock.schedule_message(fine_clock.now() + 20s,
+                              actor_cast<strong_actor_ptr>(aut),
+                              make_mailbox_element(nullptr, make_message_id(),
+                                                   {}, "foo"));
+  auto now = fine_clock.now();
+  CAF_CHECK_EQUAL(fine_clock.trigger_expired_timeouts(now + 10s), 0u);
+  CAF_CHECK_EQUAL(fine_clock.trigger_expired_timeouts(now + 19s), 0u);
+  CAF_CHECK_EQUAL(fine_clock.trigger_expired_timeouts(now + 21s), 1u);
+  expect((std::string), to(aut).with("foo"));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,51 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.tsc_clock
+
+#include "caf/detail/tsc_clock.hpp"
+
+#include "caf/test/unit_test.hpp"
+
+#include <chrono>
+#include <thread>
+
+using namespace caf;
+
+using detail::tsc_clock;
+
+CAF_TEST(the clock is monotonic) {
+  auto t0 = tsc_clock::now();
+  auto t1 = tsc_clock::now();
+  CAF_CHECK_LESS_OR_EQUAL(t0, t1);
+}
+
+CAF_TEST(ticks convert to durations and back) {
+  CAF_CHECK_GREATER(tsc_clock::ticks_per_ns(), 0.);
+  timespan x{std::chrono::milliseconds(5)};
+  auto ticks = tsc_clock::ticks(x);
+  auto y = tsc_clock::duration(ticks);
+  CAF_CHECK_LESS(std::chrono::abs(y - x), std::chrono::microseconds(1));
+}
+
+CAF_TEST(ticks measure elapsed time) {
+  auto t0 = tsc_clock::now();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  auto elapsed = tsc_clock::duration(tsc_clock::now() - t0);
+  CAF_CHECK_GREATER_OR_EQUAL(elapsed, std::chrono::milliseconds(5));
+}
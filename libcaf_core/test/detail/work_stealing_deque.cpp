@@ -0,0 +1,121 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE detail.work_stealing_deque
+
+#include "caf/detail/work_stealing_deque.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace caf;
+
+namespace {
+
+using int_deque = detail::work_stealing_deque<int>;
+
+struct fixture {
+  fixture() : queue(2) {
+    for (size_t i = 0; i < values.size(); ++i)
+      values[i] = static_cast<int>(i);
+  }
+
+  int_deque queue;
+  std::array<int, 1000> values;
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(work_stealing_deque_tests, fixture)
+
+CAF_TEST(default constructed deques are empty) {
+  CAF_CHECK(queue.empty());
+  CAF_CHECK_EQUAL(queue.size(), 0u);
+  CAF_CHECK_EQUAL(queue.take(), nullptr);
+  CAF_CHECK_EQUAL(queue.steal(), nullptr);
+}
+
+CAF_TEST(owners take elements in LIFO order) {
+  for (int i = 0; i < 3; ++i)
+    queue.push(&values[i]);
+  CAF_CHECK_EQUAL(queue.size(), 3u);
+  CAF_CHECK_EQUAL(*queue.take(), 2);
+  CAF_CHECK_EQUAL(*queue.take(), 1);
+  CAF_CHECK_EQUAL(*queue.take(), 0);
+  CAF_CHECK_EQUAL(queue.take(), nullptr);
+}
+
+CAF_TEST(thieves steal elements in FIFO order) {
+  for (int i = 0; i < 3; ++i)
+    queue.push(&values[i]);
+  CAF_CHECK_EQUAL(*queue.steal(), 0);
+  CAF_CHECK_EQUAL(*queue.steal(), 1);
+  CAF_CHECK_EQUAL(*queue.take(), 2);
+  CAF_CHECK_EQUAL(queue.steal(), nullptr);
+}
+
+CAF_TEST(deques grow when running out of capacity) {
+  CAF_CHECK_EQUAL(queue.capacity(), 4u);
+  for (int i = 0; i < 10; ++i)
+    queue.push(&values[i]);
+  CAF_CHECK_EQUAL(queue.capacity(), 16u);
+  CAF_CHECK_EQUAL(queue.size(), 10u);
+  for (int i = 0; i < 5; ++i)
+    CAF_CHECK_EQUAL(*queue.steal(), i);
+  for (int i = 9; i >= 5; --i)
+    CAF_CHECK_EQUAL(*queue.take(), i);
+  CAF_CHECK(queue.empty());
+}
+
+CAF_TEST(concurrent steals never lose or duplicate elements) {
+  std::atomic<bool> done{false};
+  std::vector<std::vector<int>> stolen(3);
+  std::vector<std::thread> thieves;
+  for (size_t i = 0; i < stolen.size(); ++i)
+    thieves.emplace_back([&, i] {
+      for (;;) {
+        if (auto ptr = queue.steal())
+          stolen[i].push_back(*ptr);
+        else if (done)
+          return;
+      }
+    });
+  std::vector<int> taken;
+  for (size_t i = 0; i < values.size(); ++i) {
+    queue.push(&values[i]);
+    if (i % 3 == 0)
+      if (auto ptr = queue.take())
+        taken.push_back(*ptr);
+  }
+  while (auto ptr = queue.take())
+    taken.push_back(*ptr);
+  done = true;
+  for (auto& t : thieves)
+    t.join();
+  for (auto& xs : stolen)
+    taken.insert(taken.end(), xs.begin(), xs.end());
+  std::sort(taken.begin(), taken.end());
+  CAF_REQUIRE_EQUAL(taken.size(), values.size());
+  CAF_CHECK(std::equal(taken.begin(), taken.end(), values.begin()));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
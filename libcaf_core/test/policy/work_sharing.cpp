@@ -0,0 +1,75 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE policy.work_sharing
+
+#include "caf/policy/work_sharing.hpp"
+
+#include "caf/test/unit_test.hpp"
+
+#include <vector>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr size_t num_workers = 4;
+
+behavior echo() {
+  return {
+    [](int x) { return x; },
+  };
+}
+
+struct config : actor_system_config {
+  config() {
+    set("scheduler.policy", atom("sharing"));
+    set("scheduler.max-threads", num_workers);
+  }
+};
+
+void run_send_all(size_t num_actors, int num_rounds) {
+  config cfg;
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  std::vector<actor> auts;
+  for (size_t i = 0; i < num_actors; ++i)
+    auts.emplace_back(sys.spawn(echo));
+  for (int i = 0; i < num_rounds; ++i) {
+    self->send_all(auts, i);
+    size_t received = 0;
+    int sum = 0;
+    self->receive_for(received, auts.size())([&](int x) { sum += x; });
+    CAF_CHECK_EQUAL(sum, static_cast<int>(num_actors) * i);
+  }
+  for (auto& aut : auts)
+    anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+} // namespace
+
+CAF_TEST(workers pick up all jobs from the central queue) {
+  run_send_all(3 * num_workers, 100);
+}
+
+CAF_TEST(jobs exceeding the ring capacity go to the overflow list) {
+  size_t capacity = size_t{1} << policy::work_sharing::log_queue_capacity;
+  run_send_all(capacity + capacity / 2, 3);
+}
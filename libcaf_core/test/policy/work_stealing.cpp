@@ -0,0 +1,170 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+#define CAF_SUITE policy.work_stealing
+
+#include "caf/policy/work_stealing.hpp"
+
+#include "caf/test/unit_test.hpp"
+
+#include <cstdint>
+#include <set>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr size_t num_workers = 4;
+
+constexpr int num_messages = 100;
+
+class tracer : public event_based_actor {
+public:
+  tracer(actor_config& cfg) : event_based_actor(cfg) {
+    // nop
+  }
+
+  behavior make_behavior() override {
+    return {
+      [=](get_atom) {
+        return reinterpret_cast<uintptr_t>(context());
+      },
+      [=](get_atom, get_atom) {
+        return static_cast<uint64_t>(last_worker());
+      },
+    };
+  }
+};
+
+struct config : actor_system_config {
+  config(atom_value policy) {
+    set("scheduler.policy", policy);
+    set("scheduler.max-threads", num_workers);
+    set("scheduler.sticky-scheduling", true);
+  }
+};
+
+// Returns the ID of the worker that runs `aut` while processing the request.
+uint64_t worker_of(actor_system& sys, scoped_actor& self, const actor& aut) {
+  uint64_t result = actor_config::no_worker;
+  self->request(aut, infinite, get_atom::value, get_atom::value).receive(
+    [&](uint64_t x) { result = x; },
+    [&](error& err) { CAF_FAIL("unexpected error: " << sys.render(err)); });
+  return result;
+}
+
+scheduled_actor* deref(const actor& hdl) {
+  return static_cast<scheduled_actor*>(actor_cast<abstract_actor*>(hdl));
+}
+
+void run_pinned(atom_value policy) {
+  config cfg{policy};
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  actor_config acfg;
+  acfg.pinned_worker = 2;
+  auto aut = sys.spawn_class<tracer, no_spawn_options>(acfg);
+  std::set<uintptr_t> contexts;
+  for (int i = 0; i < num_messages; ++i) {
+    self->request(aut, infinite, get_atom::value).receive(
+      [&](uintptr_t x) { contexts.emplace(x); },
+      [&](error& err) { CAF_FAIL("unexpected error: " << sys.render(err)); });
+    CAF_CHECK_EQUAL(worker_of(sys, self, aut), 2u);
+  }
+  CAF_CHECK_EQUAL(contexts.size(), 1u);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+void run_invalid_pin(atom_value policy) {
+  config cfg{policy};
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  actor_config acfg;
+  acfg.pinned_worker = num_workers + 3;
+  auto aut = sys.spawn_class<tracer, no_spawn_options>(acfg);
+  CAF_CHECK_EQUAL(deref(aut)->pinned_worker(), actor_config::no_worker);
+  CAF_CHECK(!deref(aut)->pin_to_worker(num_workers));
+  CAF_CHECK_EQUAL(deref(aut)->pinned_worker(), actor_config::no_worker);
+  CAF_CHECK(deref(aut)->pin_to_worker(1));
+  // the actor moves to its new worker on its next activation, but it may
+  // still consume messages that arrive before it blocks on its old worker
+  int attempts = 0;
+  while (worker_of(sys, self, aut) != 1u && ++attempts < num_messages)
+    ; // nop
+  CAF_CHECK_LESS(attempts, num_messages);
+  for (int i = 0; i < num_messages; ++i)
+    CAF_CHECK_EQUAL(worker_of(sys, self, aut), 1u);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+void run_sticky(atom_value policy) {
+  config cfg{policy};
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  auto aut = sys.spawn<tracer>();
+  // give all workers time to finish polling after startup and to park
+  for (int i = 0; i < 10; ++i)
+    CAF_CHECK_LESS(worker_of(sys, self, aut), num_workers);
+  // without any backlog, each activation must run on the same worker
+  auto id = worker_of(sys, self, aut);
+  CAF_REQUIRE_LESS(id, num_workers);
+  for (int i = 0; i < num_messages; ++i)
+    CAF_CHECK_EQUAL(worker_of(sys, self, aut), id);
+  anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+void run_send_all(atom_value policy) {
+  config cfg{policy};
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  std::vector<actor> auts;
+  for (size_t i = 0; i < 3 * num_workers; ++i)
+    auts.emplace_back(sys.spawn<tracer>());
+  for (int i = 0; i < num_messages; ++i) {
+    self->send_all(auts, get_atom::value);
+    size_t received = 0;
+    self->receive_for(received, auts.size())(
+      [&](uintptr_t x) { CAF_CHECK_NOT_EQUAL(x, 0u); });
+  }
+  for (auto& aut : auts)
+    anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+} // namespace
+
+CAF_TEST(batched sends schedule all receivers) {
+  run_send_all(atom("stealing"));
+  run_send_all(atom("lockfree"));
+  run_send_all(atom("sharing"));
+}
+
+CAF_TEST(pinned actors always run on the same worker) {
+  run_pinned(atom("stealing"));
+  run_pinned(atom("lockfree"));
+}
+
+CAF_TEST(out of range worker IDs do not pin actors) {
+  run_invalid_pin(atom("stealing"));
+  run_invalid_pin(atom("lockfree"));
+}
+
+CAF_TEST(sticky scheduling tracks the last worker of an actor) {
+  run_sticky(atom("stealing"));
+  run_sticky(atom("lockfree"));
+}
@@ -0,0 +1,166 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE scheduled_actor
+
+#include "caf/scheduled_actor.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <chrono>
+#include <limits>
+#include <vector>
+
+#include "caf/all.hpp"
+#include "caf/detail/tsc_clock.hpp"
+
+using namespace caf;
+
+namespace {
+
+constexpr auto max_throughput = std::numeric_limits<size_t>::max();
+
+constexpr int num_messages = 10;
+
+// An execution unit with a resume budget that collects jobs in a list.
+class budget_unit : public execution_unit {
+public:
+  budget_unit(actor_system* sys, timespan budget, bool adaptive)
+    : execution_unit(sys) {
+    resume_budget_ = detail::tsc_clock::ticks(budget);
+    adaptive_resume_budget_ = adaptive;
+  }
+
+  void exec_later(resumable* ptr) override {
+    jobs.emplace_back(ptr);
+  }
+
+  std::vector<resumable*> jobs;
+};
+
+// Keeps the CPU busy for `x` before returning.
+void spin(timespan x) {
+  auto t0 = std::chrono::steady_clock::now();
+  while (std::chrono::steady_clock::now() - t0 < x)
+    ; // nop
+}
+
+// Counts messages, spending a fixed amount of time on each one.
+behavior slow_counter(event_based_actor*, int* count) {
+  return {
+    [=](int) {
+      spin(std::chrono::microseconds(300));
+      ++*count;
+    },
+  };
+}
+
+struct fixture : test_coordinator_fixture<> {
+  int count = 0;
+
+  actor aut;
+
+  scheduled_actor* aut_ptr;
+
+  fixture() {
+    aut = sys.spawn(slow_counter, &count);
+    run();
+    aut_ptr = static_cast<scheduled_actor*>(actor_cast<abstract_actor*>(aut));
+  }
+
+  ~fixture() {
+    anon_send_exit(aut, exit_reason::user_shutdown);
+    run();
+  }
+
+  void fill_mailbox() {
+    for (int i = 0; i < num_messages; ++i)
+      self->send(aut, i);
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(scheduled_actor_tests, fixture)
+
+CAF_TEST(actors without resume budget consume all messages) {
+  fill_mailbox();
+  budget_unit unit{&sys, timespan{0}, false};
+  CAF_CHECK_EQUAL(aut_ptr->resume(&unit, max_throughput),
+                  resumable::awaiting_message);
+  CAF_CHECK_EQUAL(count, num_messages);
+}
+
+CAF_TEST(actors yield after exhausting their resume budget) {
+  fill_mailbox();
+  budget_unit unit{&sys, std::chrono::milliseconds(1), false};
+  CAF_CHECK_EQUAL(aut_ptr->resume(&unit, max_throughput),
+                  resumable::resume_later);
+  CAF_CHECK_GREATER(count, 0);
+  CAF_CHECK_LESS(count, num_messages);
+  while (aut_ptr->resume(&unit, max_throughput) == resumable::resume_later)
+    ; // nop
+  CAF_CHECK_EQUAL(count, num_messages);
+}
+
+CAF_TEST(adaptive budgets derive a message quota from observed costs) {
+  fill_mailbox();
+  budget_unit unit{&sys, std::chrono::milliseconds(1), true};
+  CAF_MESSAGE("the first run measures the cost per message");
+  CAF_CHECK_EQUAL(aut_ptr->resume(&unit, max_throughput),
+                  resumable::resume_later);
+  auto first_run = count;
+  CAF_CHECK_GREATER(first_run, 0);
+  CAF_MESSAGE("the second run consumes a fixed quota of messages");
+  CAF_CHECK_EQUAL(aut_ptr->resume(&unit, max_throughput),
+                  resumable::resume_later);
+  CAF_CHECK_GREATER(count, first_run);
+  CAF_CHECK_LESS(count, num_messages);
+  while (aut_ptr->resume(&unit, max_throughput) == resumable::resume_later)
+    ; // nop
+  CAF_CHECK_EQUAL(count, num_messages);
+}
+
+CAF_TEST(workers read their resume budget from the config) {
+  actor_system_config cfg;
+  cfg.set("scheduler.policy", atom("stealing"));
+  cfg.set("scheduler.max-threads", 1);
+  cfg.set("scheduler.max-resume-time", timespan{std::chrono::milliseconds(2)});
+  actor_system sys2{cfg};
+  CAF_CHECK_EQUAL(sys2.scheduler().max_resume_time(),
+                  timespan{std::chrono::milliseconds(2)});
+  CAF_CHECK(!sys2.scheduler().adaptive_resume_time());
+  scoped_actor self2{sys2};
+  auto probe = sys2.spawn([](event_based_actor* self) -> behavior {
+    return {
+      [=](get_atom) {
+        return static_cast<uint64_t>(self->context()->resume_budget());
+      },
+    };
+  });
+  self2->request(probe, infinite, get_atom::value)
+    .receive(
+      [&](uint64_t ticks) {
+        CAF_CHECK_EQUAL(ticks, detail::tsc_clock::ticks(
+                                 timespan{std::chrono::milliseconds(2)}));
+      },
+      [&](error& err) { CAF_FAIL(sys2.render(err)); });
+  anon_send_exit(probe, exit_reason::user_shutdown);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
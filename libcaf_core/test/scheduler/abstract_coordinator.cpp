@@ -0,0 +1,193 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE scheduler.abstract_coordinator
+
+#include "caf/scheduler/abstract_coordinator.hpp"
+
+#include "caf/test/unit_test.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+
+namespace {
+
+using pool_ptr = scheduler::abstract_coordinator*;
+
+using wrong_pool_atom = atom_constant<atom("wrongPool")>;
+
+// Replies with the pool of the worker running the actor.
+behavior pool_reporter(event_based_actor* self) {
+  return {
+    [=](get_atom) {
+      auto pool = self->context()->pool();
+      return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(pool));
+    },
+  };
+}
+
+class reporter : public event_based_actor {
+public:
+  reporter(actor_config& cfg) : event_based_actor(cfg) {
+    // nop
+  }
+
+  behavior make_behavior() override {
+    return pool_reporter(this);
+  }
+};
+
+// Bounces a counter between two actors, verifying on each step that it runs
+// in the expected pool.
+behavior ping_pong(event_based_actor* self, pool_ptr expected) {
+  return {
+    [=](int value, const actor& other, const actor& observer) {
+      if (self->context()->pool() != expected) {
+        self->send(observer, wrong_pool_atom::value);
+        return;
+      }
+      if (value == 0)
+        self->send(observer, ok_atom::value);
+      else
+        self->send(other, value - 1, actor_cast<actor>(self), observer);
+    },
+  };
+}
+
+struct config : actor_system_config {
+  config() {
+    set("scheduler.policy", atom("stealing"));
+    set("scheduler.max-threads", 2);
+    // Pools have no predefined options, hence we can't use `set` here.
+    put(content, "scheduler.pools.fast.policy", atom("sharing"));
+    put(content, "scheduler.pools.fast.max-threads", 1);
+    put(content, "scheduler.pools.fast.max-throughput", 5);
+    put(content, "scheduler.pools.bulk.max-threads", 3);
+  }
+};
+
+struct fixture {
+  config cfg;
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+
+  uint64_t pool_of(const actor& hdl) {
+    uint64_t result = 0;
+    self->request(hdl, infinite, get_atom::value)
+      .receive([&](uint64_t x) { result = x; },
+               [&](error& err) { CAF_FAIL(sys.render(err)); });
+    return result;
+  }
+
+  static uint64_t to_u64(pool_ptr ptr) {
+    return static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr));
+  }
+};
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(scheduler_pool_tests, fixture)
+
+CAF_TEST(pools read their settings from scheduler.pools) {
+  auto fast = sys.scheduler_pool("fast");
+  auto bulk = sys.scheduler_pool("bulk");
+  CAF_REQUIRE(fast != nullptr);
+  CAF_REQUIRE(bulk != nullptr);
+  CAF_CHECK(sys.scheduler_pool("slow") == nullptr);
+  CAF_CHECK(!sys.scheduler().is_pool());
+  CAF_CHECK(fast->is_pool());
+  CAF_CHECK_EQUAL(fast->pool_name(), "fast");
+  CAF_CHECK_EQUAL(fast->num_workers(), 1u);
+  CAF_CHECK_EQUAL(fast->max_throughput(), 5u);
+  CAF_CHECK_EQUAL(bulk->num_workers(), 3u);
+  CAF_CHECK_EQUAL(bulk->max_throughput(), sys.scheduler().max_throughput());
+}
+
+CAF_TEST(actors run in the pool selected at spawn time) {
+  auto fast = sys.scheduler_pool("fast");
+  auto dflt = sys.spawn(pool_reporter);
+  auto pooled = sys.spawn_in_pool("fast", pool_reporter);
+  auto class_pooled = sys.spawn_in_pool<reporter>("fast");
+  actor_config acfg;
+  acfg.pool = sys.scheduler_pool("bulk");
+  auto cfg_pooled = sys.spawn_class<reporter, no_spawn_options>(acfg);
+  for (int i = 0; i < 10; ++i) {
+    CAF_CHECK_EQUAL(pool_of(dflt), 0u);
+    CAF_CHECK_EQUAL(pool_of(pooled), to_u64(fast));
+    CAF_CHECK_EQUAL(pool_of(class_pooled), to_u64(fast));
+    CAF_CHECK_EQUAL(pool_of(cfg_pooled), to_u64(acfg.pool));
+  }
+  CAF_CHECK(!sys.spawn_in_pool("slow", pool_reporter));
+  CAF_CHECK(!sys.spawn_in_pool<reporter>("slow"));
+  for (auto& hdl : {dflt, pooled, class_pooled, cfg_pooled})
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+}
+
+CAF_TEST(messages cross pool boundaries transparently) {
+  auto fast = sys.scheduler_pool("fast");
+  auto bulk = sys.scheduler_pool("bulk");
+  auto a = sys.spawn_in_pool("fast", ping_pong, fast);
+  auto b = sys.spawn_in_pool("bulk", ping_pong, bulk);
+  auto c = sys.spawn(ping_pong, pool_ptr{nullptr});
+  self->send(a, 100, b, actor{self});
+  self->send(b, 100, c, actor{self});
+  self->send(c, 100, a, actor{self});
+  for (int i = 0; i < 3; ++i)
+    self->receive(
+      [](ok_atom) { CAF_MESSAGE("ping-pong done"); },
+      [](wrong_pool_atom) { CAF_FAIL("actor ran in the wrong pool"); });
+  for (auto& hdl : {a, b, c})
+    anon_send_exit(hdl, exit_reason::user_shutdown);
+}
+
+CAF_TEST(pooled actors use the clock of the default scheduler) {
+  auto aut = sys.spawn_in_pool("fast", [](event_based_actor* ptr) -> behavior {
+    return {
+      [=](ok_atom, const actor& observer) {
+        ptr->delayed_send(observer, std::chrono::milliseconds(1),
+                          ok_atom::value);
+      },
+    };
+  });
+  self->send(aut, ok_atom::value, actor{self});
+  self->receive([](ok_atom) { CAF_MESSAGE("received delayed message"); },
+                after(std::chrono::seconds(10)) >>
+                  [] { CAF_FAIL("delayed message did not arrive"); });
+  anon_send_exit(aut, exit_reason::user_shutdown);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
+
+CAF_TEST(pools are configurable via INI files) {
+  std::istringstream ini{"[scheduler]\n"
+                         "max-threads=1\n"
+                         "pools={gateway={policy='sharing', max-threads=2}}\n"};
+  actor_system_config cfg;
+  if (auto err = cfg.parse(0, nullptr, ini))
+    CAF_FAIL("parse() failed: " << to_string(err));
+  actor_system sys{cfg};
+  auto gateway = sys.scheduler_pool("gateway");
+  CAF_REQUIRE(gateway != nullptr);
+  CAF_CHECK_EQUAL(gateway->num_workers(), 2u);
+  CAF_CHECK_EQUAL(sys.scheduler().num_workers(), 1u);
+}
@@ -0,0 +1,179 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE telemetry.metric_registry
+
+#include "caf/telemetry/metric_registry.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "caf/all.hpp"
+
+using namespace caf;
+using namespace caf::telemetry;
+
+namespace {
+
+class counter_actor : public event_based_actor {
+public:
+  using event_based_actor::event_based_actor;
+
+  const char* name() const override {
+    return "counter_actor";
+  }
+
+  behavior make_behavior() override {
+    return {
+      [=](int x) { return x + 1; },
+    };
+  }
+};
+
+struct config : actor_system_config {
+  config() {
+    set("metrics.enable", true);
+  }
+};
+
+struct fixture : test_coordinator_fixture<config> {
+  int64_t value_of(string_view name) {
+    return sys.metrics()
+      .counter_instance(name, {{"name", "counter_actor"}}, "")
+      ->value();
+  }
+};
+
+} // namespace
+
+CAF_TEST(counters sum up increments from all threads) {
+  metric_registry reg;
+  auto x = reg.counter_instance("foo_total", {}, "Foo.");
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i)
+    threads.emplace_back([x] {
+      for (int j = 0; j < 1000; ++j)
+        x->inc();
+    });
+  for (auto& t : threads)
+    t.join();
+  CAF_CHECK_EQUAL(x->value(), 4000);
+}
+
+CAF_TEST(gauges go up and down) {
+  metric_registry reg;
+  auto x = reg.gauge_instance("foo", {}, "Foo.");
+  x->inc(10);
+  x->dec();
+  x->dec(4);
+  CAF_CHECK_EQUAL(x->value(), 5);
+}
+
+CAF_TEST(histograms sort observations into buckets) {
+  metric_registry reg;
+  auto x = reg.histogram_instance("foo", {}, "Foo.", {1., 2., 4.});
+  for (auto val : {0.5, 1., 1.5, 3., 10.})
+    x->observe(val);
+  CAF_CHECK_EQUAL(x->bucket_counts(), std::vector<int64_t>({2, 1, 1, 1}));
+  CAF_CHECK_EQUAL(x->count(), 5);
+  CAF_CHECK_EQUAL(x->sum(), 16.);
+}
+
+CAF_TEST(the registry returns the same instance for the same labels) {
+  metric_registry reg;
+  auto x = reg.counter_instance("foo_total", {{"a", "1"}}, "Foo.");
+  auto y = reg.counter_instance("foo_total", {{"a", "2"}}, "Foo.");
+  CAF_CHECK_NOT_EQUAL(x, y);
+  CAF_CHECK_EQUAL(x, reg.counter_instance("foo_total", {{"a", "1"}}, "Foo."));
+  CAF_CHECK_EQUAL(reg.actor_instances("foo"), reg.actor_instances("foo"));
+}
+
+CAF_TEST(the registry renders metrics in the Prometheus text format) {
+  metric_registry reg;
+  reg.counter_instance("foo_total", {{"a", "1"}}, "Foo.")->inc(3);
+  reg.counter_instance("foo_total", {{"a", "x\"y"}}, "Foo.")->inc(2);
+  reg.gauge_instance("bar", {}, "Bar.")->inc(7);
+  auto hist = reg.histogram_instance("baz_seconds", {{"b", "2"}}, "Baz.",
+                                     {0.5, 1.});
+  hist->observe(0.25);
+  hist->observe(2.);
+  CAF_CHECK_EQUAL(reg.to_prometheus(),
+                  "# HELP bar Bar.\n"
+                  "# TYPE bar gauge\n"
+                  "bar 7\n"
+                  "# HELP baz_seconds Baz.\n"
+                  "# TYPE baz_seconds histogram\n"
+                  "baz_seconds_bucket{b=\"2\",le=\"0.5\"} 1\n"
+                  "baz_seconds_bucket{b=\"2\",le=\"1\"} 1\n"
+                  "baz_seconds_bucket{b=\"2\",le=\"+Inf\"} 2\n"
+                  "baz_seconds_sum{b=\"2\"} 2.25\n"
+                  "baz_seconds_count{b=\"2\"} 2\n"
+                  "# HELP foo_total Foo.\n"
+                  "# TYPE foo_total counter\n"
+                  "foo_total{a=\"1\"} 3\n"
+                  "foo_total{a=\"x\\\"y\"} 2\n");
+}
+
+CAF_TEST_FIXTURE_SCOPE(actor_metrics_tests, fixture)
+
+CAF_TEST(actors count sent received and processed messages) {
+  auto aut = sys.spawn<counter_actor>();
+  run();
+  for (int i = 0; i < 3; ++i)
+    self->send(aut, i);
+  auto m = sys.metrics().actor_instances("counter_actor");
+  CAF_CHECK_EQUAL(m->received->value(), 3);
+  CAF_CHECK_EQUAL(m->mailbox_size->value(), 3);
+  expect((int), from(self).to(aut).with(0));
+  CAF_CHECK_EQUAL(m->processed->value(), 1);
+  CAF_CHECK_EQUAL(m->mailbox_size->value(), 2);
+  CAF_CHECK_EQUAL(m->sent->value(), 1);
+  run();
+  CAF_CHECK_EQUAL(value_of("caf_actor_messages_received_total"), 3);
+  CAF_CHECK_EQUAL(value_of("caf_actor_messages_processed_total"), 3);
+  CAF_CHECK_EQUAL(value_of("caf_actor_messages_sent_total"), 3);
+  CAF_CHECK_EQUAL(m->mailbox_size->value(), 0);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
+
+CAF_TEST(workers count resumed jobs) {
+  config cfg;
+  cfg.set("scheduler.max-threads", size_t{2});
+  actor_system sys{cfg};
+  {
+    scoped_actor self{sys};
+    auto aut = sys.spawn<counter_actor>();
+    for (int i = 0; i < 10; ++i)
+      self->request(aut, infinite, i).receive([](int) {}, [](error&) {});
+    anon_send_exit(aut, exit_reason::user_shutdown);
+  }
+  auto& reg = sys.metrics();
+  int64_t total = 0;
+  for (size_t id = 0; id < 2; ++id)
+    total += reg.worker_instances("default", id).resumed_jobs->value();
+  CAF_CHECK_GREATER_OR_EQUAL(total, 10);
+  auto text = reg.to_prometheus();
+  CAF_CHECK_NOT_EQUAL(text.find("caf_scheduler_resumed_jobs_total{pool="
+                                "\"default\",worker=\"0\"}"),
+                      std::string::npos);
+  CAF_CHECK_NOT_EQUAL(text.find("# TYPE caf_scheduler_park_seconds histogram"),
+                      std::string::npos);
+}
@@ -158,6 +158,15 @@ public:
   /// Writes `data` into the buffer for a given connection.
   void write(connection_handle hdl, size_t bs, const void* buf);
 
+  /// Appends `buf` to the output of a given connection. Avoids copying large
+  /// buffers into the write buffer.
+  void write(connection_handle hdl, byte_buffer buf);
+
+  /// Appends the content of `buf` to the output of a given connection and
+  /// clears `buf`. Leaves a recycled buffer in `buf` whenever the connection
+  /// takes ownership of the content instead of copying it.
+  void hand_over(connection_handle hdl, byte_buffer& buf);
+
   /// Sends the content of the buffer for a given connection.
   void flush(connection_handle hdl);
 
@@ -357,7 +366,9 @@ public:
   std::vector<connection_handle> connections() const;
 
   /// Returns the `multiplexer` running this broker.
-  network::multiplexer& backend();
+  network::multiplexer& backend() noexcept {
+    return *backend_;
+  }
 
 protected:
   void init_broker();
@@ -432,6 +443,7 @@ private:
   doorman_map doormen_;
   datagram_servant_map datagram_servants_;
   byte_buffer dummy_wr_buf_;
+  network::multiplexer* backend_;
 };
 
 } // namespace caf::io
@@ -94,6 +94,11 @@ public:
     /// Returns a reference to the sent buffer.
     virtual byte_buffer& get_buffer(connection_handle hdl) = 0;
 
+    /// Appends the content of `buf` to the output of `hdl` and clears `buf`.
+    /// Large buffers are handed over to the connection without copying them,
+    /// leaving a recycled buffer in `buf`.
+    virtual void write_buffer(connection_handle hdl, byte_buffer& buf) = 0;
+
     /// Flushes the underlying write buffer of `hdl`.
     virtual void flush(connection_handle hdl) = 0;
 
@@ -176,8 +181,8 @@ public:
   }
 
   /// Writes a header followed by its payload to `storage`.
-  static void write(execution_unit* ctx, byte_buffer& buf, header& hdr,
-                    payload_writer* pw = nullptr);
+  void write(execution_unit* ctx, byte_buffer& buf, header& hdr,
+             payload_writer* pw = nullptr);
 
   /// Writes the server handshake containing the information of the
   /// actor published at `port` to `buf`. If `port == none` or
@@ -234,6 +239,8 @@ private:
   callee& callee_;
   message_queue queue_;
   detail::worker_hub<worker> hub_;
+  telemetry::counter* bytes_received_;
+  telemetry::counter* bytes_sent_;
 };
 
 /// @}
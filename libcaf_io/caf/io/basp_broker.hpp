@@ -94,6 +94,8 @@ public:
 
   byte_buffer& get_buffer(connection_handle hdl) override;
 
+  void write_buffer(connection_handle hdl, byte_buffer& buf) override;
+
   void flush(connection_handle hdl) override;
 
   void handle_heartbeat() override;
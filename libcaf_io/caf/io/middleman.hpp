@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <map>
 #include <memory>
@@ -125,7 +126,7 @@ public:
   middleman_actor actor_handle();
 
   /// Returns the broker associated with `name` or creates a
-  /// new instance of type `Impl`.
+  /// new instance of type `Impl`. Named brokers always run in `backend()`.
   template <class Impl>
   actor named_broker(atom_value name) {
     auto i = named_brokers_.find(name);
@@ -147,6 +148,22 @@ public:
   /// Returns the IO backend used by this middleman.
   virtual network::multiplexer& backend() = 0;
 
+  /// Returns the number of IO backends, each running in its own thread.
+  size_t num_backends() const noexcept {
+    return extra_backends_.size() + 1;
+  }
+
+  /// Returns the IO backend at index `x`, whereas index 0 is `backend()`.
+  /// @pre `x < num_backends()`
+  network::multiplexer& backend_at(size_t x);
+
+  /// Returns the IO backend for the next broker. Picks backends round-robin.
+  network::multiplexer& next_backend();
+
+  /// Returns the IO backend that matches `host` or `backend()` if `host` does
+  /// not point to any of the backends of this middleman.
+  network::multiplexer& backend_of(execution_unit* host);
+
   /// Returns the actor associated with `name` at `nid` or
   /// `invalid_actor` if `nid` is not connected or has no actor
   /// associated to this `name`.
@@ -201,7 +218,7 @@ public:
     static constexpr bool spawnable = detail::spawnable<F, impl, Ts...>();
     static_assert(spawnable,
                   "cannot spawn function-based broker with given arguments");
-    actor_config cfg{&backend()};
+    actor_config cfg{&next_backend()};
     detail::bool_token<spawnable> enabled;
     return system().spawn_functor<Os>(enabled, cfg, fun,
                                       std::forward<Ts>(xs)...);
@@ -267,17 +284,23 @@ public:
 protected:
   middleman(actor_system& sys);
 
+  /// Creates an additional backend for running brokers in parallel. The
+  /// default implementation returns `nullptr`, i.e., does not support
+  /// multiple backends.
+  virtual backend_pointer make_backend();
+
 private:
   template <spawn_options Os, class Impl, class F, class... Ts>
   expected<typename infer_handle_from_class<Impl>::type>
   spawn_client_impl(F fun, const std::string& host, uint16_t port, Ts&&... xs) {
-    auto eptr = backend().new_tcp_scribe(host, port);
+    auto& mpx = next_backend();
+    auto eptr = mpx.new_tcp_scribe(host, port);
     if (!eptr)
       return eptr.error();
     auto ptr = std::move(*eptr);
     CAF_ASSERT(ptr != nullptr);
     detail::init_fun_factory<Impl, F> fac;
-    actor_config cfg{&backend()};
+    actor_config cfg{&mpx};
     auto fptr = fac.make(std::move(fun), ptr->hdl(), std::forward<Ts>(xs)...);
     fptr->hook([=](local_actor* self) mutable {
       static_cast<abstract_broker*>(self)->add_scribe(std::move(ptr));
@@ -289,7 +312,8 @@ private:
   template <spawn_options Os, class Impl, class F, class... Ts>
   expected<typename infer_handle_from_class<Impl>::type>
   spawn_server_impl(F fun, uint16_t& port, Ts&&... xs) {
-    auto eptr = backend().new_tcp_doorman(port);
+    auto& mpx = next_backend();
+    auto eptr = mpx.new_tcp_doorman(port);
     if (!eptr)
       return eptr.error();
     auto ptr = std::move(*eptr);
@@ -299,11 +323,14 @@ private:
     fptr->hook([=](local_actor* self) mutable {
       static_cast<abstract_broker*>(self)->add_doorman(std::move(ptr));
     });
-    actor_config cfg{&backend()};
+    actor_config cfg{&mpx};
     cfg.init_fun.assign(fptr.release());
     return system().spawn_class<Impl, Os>(cfg);
   }
 
+  /// Starts a thread running `mpx` and blocks until `mpx` knows its thread ID.
+  std::thread launch_backend(network::multiplexer& mpx);
+
   expected<strong_actor_ptr>
   remote_spawn_impl(const node_id& nid, std::string& name, message& args,
                     std::set<std::string> s, timespan timeout);
@@ -325,6 +352,14 @@ private:
   network::multiplexer::supervisor_ptr backend_supervisor_;
   // runs the backend
   std::thread thread_;
+  // additional backends for running brokers in parallel
+  std::vector<backend_pointer> extra_backends_;
+  // prevents additional backends from shutting down
+  std::vector<network::multiplexer::supervisor_ptr> extra_supervisors_;
+  // runs the additional backends
+  std::vector<std::thread> extra_threads_;
+  // selects the backend for the next broker
+  std::atomic<size_t> next_backend_;
   // keeps track of "singleton-like" brokers
   std::map<atom_value, actor> named_brokers_;
   // actor offering asynchronous IO by managing this singleton instance
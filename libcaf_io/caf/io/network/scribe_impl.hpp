@@ -40,6 +40,10 @@ public:
 
   byte_buffer& rd_buf() override;
 
+  void write(byte_buffer buf) override;
+
+  void hand_over(byte_buffer& buf) override;
+
   void graceful_shutdown() override;
 
   void flush() override;
@@ -18,7 +18,10 @@
 
 #pragma once
 
-#include <vector>
+#include <array>
+#include <deque>
+#include <type_traits>
+#include <utility>
 
 #include "caf/byte_buffer.hpp"
 #include "caf/detail/io_export.hpp"
@@ -29,9 +32,21 @@
 #include "caf/io/receive_policy.hpp"
 #include "caf/logger.hpp"
 #include "caf/ref_counted.hpp"
+#include "caf/span.hpp"
 
 namespace caf::io::network {
 
+/// Checks whether `Policy` can write multiple buffers with a single call.
+template <class Policy, class = void>
+struct has_gather_write : std::false_type {};
+
+template <class Policy>
+struct has_gather_write<
+  Policy, decltype(std::declval<Policy&>().write_some(
+                     std::declval<size_t&>(), std::declval<native_socket>(),
+                     std::declval<span<const span<const byte>>>()),
+                   void())> : std::true_type {};
+
 /// A stream capable of both reading and writing. The stream's input
 /// data is forwarded to its {@link stream_manager manager}.
 class CAF_IO_EXPORT stream : public event_handler {
@@ -39,6 +54,13 @@ public:
   /// A smart pointer to a stream manager.
   using manager_ptr = intrusive_ptr<stream_manager>;
 
+  /// Maximum number of buffers for a single gather write.
+  static constexpr size_t max_gather_buffers = 64;
+
+  /// Minimum size for moving a buffer to the write queue. The stream copies
+  /// smaller buffers into the write buffer instead.
+  static constexpr size_t min_chunk_size = 1024;
+
   stream(default_multiplexer& backend_ref, native_socket sockfd);
 
   /// Starts reading data from the socket, forwarding incoming data to `mgr`.
@@ -56,6 +78,19 @@ public:
   /// @warning Not thread safe.
   void write(const void* buf, size_t num_bytes);
 
+  /// Appends `buf` to the write queue without copying its content unless
+  /// `buf` is smaller than `min_chunk_size`. Data in the write buffer goes
+  /// out before `buf` and data added to the write buffer afterwards goes out
+  /// after `buf`.
+  /// @warning Not thread safe.
+  void write(byte_buffer buf);
+
+  /// Appends the content of `buf` to the output like `write(byte_buffer)`,
+  /// but leaves a recycled buffer with spare capacity in `buf` if the stream
+  /// takes ownership of its content. Afterwards, `buf` is always empty.
+  /// @warning Not thread safe.
+  void hand_over(byte_buffer& buf);
+
   /// Returns the write buffer of this stream.
   /// @warning Must not be modified outside the IO multiplexers event loop
   ///          once the stream has been started.
@@ -110,8 +145,7 @@ protected:
       }
       case io::network::operation::write: {
         size_t wb; // Written bytes.
-        auto res = policy.write_some(wb, fd(), wr_buf_.data() + written_,
-                                     wr_buf_.size() - written_);
+        auto res = write_some(policy, wb);
         handle_write_result(res, wb);
         break;
       }
@@ -122,6 +156,36 @@ protected:
   }
 
 private:
+  /// Writes pending chunks, using a single gather write if possible.
+  template <class Policy>
+  rw_state write_some(Policy& policy, size_t& wb) {
+    CAF_ASSERT(!wr_queue_.empty());
+    if constexpr (has_gather_write<Policy>::value) {
+      if (wr_queue_.size() > 1) {
+        std::array<span<const byte>, max_gather_buffers> bufs;
+        auto n = std::min(wr_queue_.size(), max_gather_buffers);
+        auto i = wr_queue_.begin();
+        bufs[0] = span<const byte>{i->data() + written_, i->size() - written_};
+        for (size_t j = 1; j < n; ++j) {
+          ++i;
+          bufs[j] = span<const byte>{i->data(), i->size()};
+        }
+        return policy.write_some(wb, fd(),
+                                 span<const span<const byte>>{bufs.data(), n});
+      }
+    }
+    auto& front = wr_queue_.front();
+    return policy.write_some(wb, fd(), front.data() + written_,
+                             front.size() - written_);
+  }
+
+  /// Returns the number of bytes that wait for transmission.
+  size_t pending_bytes() const noexcept;
+
+  /// Stores the memory of `buf` for re-use if it exceeds the capacity of
+  /// the current spare buffer.
+  void recycle(byte_buffer& buf);
+
   void prepare_next_read();
 
   void prepare_next_write();
@@ -148,8 +212,10 @@ private:
   // State for writing.
   manager_ptr writer_;
   size_t written_;
-  byte_buffer wr_buf_;
+  std::deque<byte_buffer> wr_queue_;
+  std::deque<byte_buffer> wr_offline_queue_;
   byte_buffer wr_offline_buf_;
+  byte_buffer wr_spare_buf_;
 };
 
 } // namespace caf::io::network
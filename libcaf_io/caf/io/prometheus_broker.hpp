@@ -0,0 +1,49 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include "caf/behavior.hpp"
+#include "caf/detail/io_export.hpp"
+#include "caf/io/broker.hpp"
+#include "caf/io/connection_handle.hpp"
+#include "caf/stateful_actor.hpp"
+
+namespace caf::io {
+
+/// State of a broker that serves metrics via HTTP.
+struct CAF_IO_EXPORT prometheus_broker_state {
+  /// Buffers incoming requests until the client sent the full header.
+  std::unordered_map<connection_handle, std::string> requests;
+
+  static const char* name;
+};
+
+/// Serves all metrics of the actor system via HTTP in the Prometheus text
+/// exposition format. Opens a TCP port and answers each `GET /metrics`
+/// request with the current values of all metrics before closing the
+/// connection. Leaving `address` empty accepts connections on any interface.
+CAF_IO_EXPORT behavior
+prometheus_broker(stateful_actor<prometheus_broker_state, broker>* self,
+                  uint16_t port, const std::string& address);
+
+} // namespace caf::io
@@ -54,6 +54,17 @@ public:
   /// Returns the current input buffer.
   virtual byte_buffer& rd_buf() = 0;
 
+  /// Appends `buf` to the output. Unlike writing to `wr_buf()`, this allows
+  /// implementations to send large buffers without copying them. The default
+  /// implementation appends `buf` to `wr_buf()`.
+  virtual void write(byte_buffer buf);
+
+  /// Appends the content of `buf` to the output and clears `buf`.
+  /// Implementations may swap a recycled buffer into `buf` after taking
+  /// ownership of its content, allowing callers to reuse the allocation. The
+  /// default implementation appends `buf` to `wr_buf()`.
+  virtual void hand_over(byte_buffer& buf);
+
   /// Flushes the output buffer, i.e., sends the
   /// content of the buffer via the network.
   virtual void flush() = 0;
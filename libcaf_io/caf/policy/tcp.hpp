@@ -18,9 +18,11 @@
 
 #pragma once
 
+#include "caf/byte.hpp"
 #include "caf/detail/io_export.hpp"
 #include "caf/io/network/native_socket.hpp"
 #include "caf/io/network/rw_state.hpp"
+#include "caf/span.hpp"
 
 namespace caf::policy {
 
@@ -42,6 +44,12 @@ struct CAF_IO_EXPORT tcp {
   write_some(size_t& result, io::network::native_socket fd, const void* buf,
              size_t len);
 
+  /// Writes up to the combined size of all `bufs` to `fd` with a single
+  /// system call. Same semantics as the single-buffer version otherwise.
+  static io::network::rw_state
+  write_some(size_t& result, io::network::native_socket fd,
+             span<const span<const byte>> bufs);
+
   /// Tries to accept a new connection from `fd`. On success,
   /// the new connection is stored in `result`. Returns true
   /// as long as
@@ -104,6 +104,28 @@ void abstract_broker::write(connection_handle hdl, size_t bs, const void* buf) {
   out.insert(out.end(), first, last);
 }
 
+void abstract_broker::write(connection_handle hdl, byte_buffer buf) {
+  CAF_ASSERT(hdl != invalid_connection_handle);
+  auto x = by_id(hdl);
+  if (!x) {
+    CAF_LOG_ERROR("tried to write to an unknown connection_handle:"
+                  << CAF_ARG(hdl));
+    return;
+  }
+  x->write(std::move(buf));
+}
+
+void abstract_broker::hand_over(connection_handle hdl, byte_buffer& buf) {
+  CAF_ASSERT(hdl != invalid_connection_handle);
+  auto x = by_id(hdl);
+  if (!x) {
+    CAF_LOG_ERROR("tried to write to an unknown connection_handle:"
+                  << CAF_ARG(hdl));
+    return;
+  }
+  x->hand_over(buf);
+}
+
 void abstract_broker::flush(connection_handle hdl) {
   auto x = by_id(hdl);
   if (x)
@@ -373,14 +395,12 @@ void abstract_broker::init_broker() {
     kvp.second->launch();
 }
 
-abstract_broker::abstract_broker(actor_config& cfg) : scheduled_actor(cfg) {
+abstract_broker::abstract_broker(actor_config& cfg)
+  : scheduled_actor(cfg),
+    backend_(&system().middleman().backend_of(cfg.host)) {
   // nop
 }
 
-network::multiplexer& abstract_broker::backend() {
-  return system().middleman().backend();
-}
-
 void abstract_broker::launch_servant(doorman_ptr& ptr) {
   // A doorman needs to be launched in addition to being initialized. This
   // allows CAF to assign doorman to uninitialized brokers.
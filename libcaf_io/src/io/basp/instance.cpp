@@ -26,6 +26,7 @@
 #include "caf/io/basp/version.hpp"
 #include "caf/io/basp/worker.hpp"
 #include "caf/settings.hpp"
+#include "caf/telemetry/metric_registry.hpp"
 
 namespace caf::io::basp {
 
@@ -39,8 +40,20 @@ instance::callee::~callee() {
 }
 
 instance::instance(abstract_broker* parent, callee& lstnr)
-  : tbl_(parent), this_node_(parent->system().node()), callee_(lstnr) {
+  : tbl_(parent),
+    this_node_(parent->system().node()),
+    callee_(lstnr),
+    bytes_received_(nullptr),
+    bytes_sent_(nullptr) {
   CAF_ASSERT(this_node_ != none);
+  auto& sys = parent->system();
+  if (sys.metrics_enabled()) {
+    auto& reg = sys.metrics();
+    bytes_received_ = reg.counter_instance("caf_basp_bytes_received_total", {},
+                                           "Bytes that BASP received.");
+    bytes_sent_ = reg.counter_instance("caf_basp_bytes_sent_total", {},
+                                       "Bytes that BASP sent.");
+  }
   auto workers
     = get_or(config(), "middleman.workers", defaults::middleman::workers);
   for (size_t i = 0; i < workers; ++i)
@@ -50,6 +63,8 @@ instance::instance(abstract_broker* parent, callee& lstnr)
 connection_state instance::handle(execution_unit* ctx, new_data_msg& dm,
                                   header& hdr, bool is_payload) {
   CAF_LOG_TRACE(CAF_ARG(dm) << CAF_ARG(is_payload));
+  if (bytes_received_ != nullptr)
+    bytes_received_->inc(static_cast<int64_t>(dm.buf.size()));
   // function object providing cleanup code on errors
   auto err = [&]() -> connection_state {
     if (auto nid = tbl_.erase_direct(dm.handle))
@@ -212,6 +227,8 @@ void instance::write(execution_unit* ctx, byte_buffer& buf, header& hdr,
   }
   if (auto err = sink(hdr))
     CAF_LOG_ERROR(CAF_ARG(err));
+  if (bytes_sent_ != nullptr)
+    bytes_sent_->inc(static_cast<int64_t>(header_size + hdr.payload_len));
 }
 
 void instance::write_server_handshake(execution_unit* ctx, byte_buffer& out_buf,
@@ -497,7 +514,12 @@ void instance::forward(execution_unit* ctx, const node_id& dest_node,
       CAF_LOG_ERROR("unable to serialize BASP header");
       return;
     }
-    bs.apply(span<const byte>{payload.data(), payload.size()});
+    if (bytes_sent_ != nullptr)
+      bytes_sent_->inc(static_cast<int64_t>(header_size + payload.size()));
+    // Let the connection decide whether to copy the payload or to take it
+    // over. In the latter case, `payload` receives a recycled buffer in
+    // return, i.e., the read side of the connection keeps its allocation.
+    callee_.write_buffer(path->hdl, payload);
     flush(*path);
   } else {
     CAF_LOG_WARNING("cannot forward message, no route to destination");
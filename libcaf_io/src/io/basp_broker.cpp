@@ -585,6 +585,10 @@ byte_buffer& basp_broker::get_buffer(connection_handle hdl) {
   return wr_buf(hdl);
 }
 
+void basp_broker::write_buffer(connection_handle hdl, byte_buffer& buf) {
+  hand_over(hdl, buf);
+}
+
 void basp_broker::flush(connection_handle hdl) {
   super::flush(hdl);
 }
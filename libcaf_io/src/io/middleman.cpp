@@ -44,6 +44,7 @@
 #include "caf/typed_event_based_actor.hpp"
 
 #include "caf/io/basp_broker.hpp"
+#include "caf/io/prometheus_broker.hpp"
 #include "caf/io/system_messages.hpp"
 
 #include "caf/io/network/default_multiplexer.hpp"
@@ -78,6 +79,11 @@ public:
     return backend_;
   }
 
+protected:
+  backend_pointer make_backend() override {
+    return backend_pointer{new T(&system())};
+  }
+
 private:
   T backend_;
 };
@@ -95,10 +101,32 @@ actor_system::module* middleman::make(actor_system& sys, detail::type_list<>) {
   }
 }
 
-middleman::middleman(actor_system& sys) : system_(sys) {
+middleman::middleman(actor_system& sys) : system_(sys), next_backend_(0) {
   // nop
 }
 
+network::multiplexer& middleman::backend_at(size_t x) {
+  CAF_ASSERT(x < num_backends());
+  return x == 0 ? backend() : *extra_backends_[x - 1];
+}
+
+network::multiplexer& middleman::next_backend() {
+  if (extra_backends_.empty())
+    return backend();
+  return backend_at(next_backend_++ % num_backends());
+}
+
+network::multiplexer& middleman::backend_of(execution_unit* host) {
+  for (auto& ptr : extra_backends_)
+    if (ptr.get() == host)
+      return *ptr;
+  return backend();
+}
+
+middleman::backend_pointer middleman::make_backend() {
+  return nullptr;
+}
+
 expected<strong_actor_ptr>
 middleman::remote_spawn_impl(const node_id& nid, std::string& name,
                              message& args, std::set<std::string> s,
@@ -268,6 +296,31 @@ strong_actor_ptr middleman::remote_lookup(atom_value name, const node_id& nid) {
   return result;
 }
 
+std::thread middleman::launch_backend(network::multiplexer& mpx) {
+  std::atomic<bool> init_done{false};
+  std::mutex mtx;
+  std::condition_variable cv;
+  auto ptr = &mpx;
+  std::thread result{[&, ptr, this] {
+    CAF_SET_LOGGER_SYS(&system());
+    detail::set_thread_name("caf.multiplexer");
+    system().thread_started();
+    CAF_LOG_TRACE("");
+    {
+      std::unique_lock<std::mutex> guard{mtx};
+      ptr->thread_id(std::this_thread::get_id());
+      init_done = true;
+      cv.notify_one();
+    }
+    ptr->run();
+    system().thread_terminates();
+  }};
+  std::unique_lock<std::mutex> guard{mtx};
+  while (init_done == false)
+    cv.wait(guard);
+  return result;
+}
+
 void middleman::start() {
   CAF_LOG_TRACE("");
   // Launch backend.
@@ -278,30 +331,37 @@ void middleman::start() {
   // thread instead. Other backends can set `middleman_detach_multiplexer` to
   // false to suppress creation of the supervisor.
   if (backend_supervisor_ != nullptr) {
-    std::atomic<bool> init_done{false};
-    std::mutex mtx;
-    std::condition_variable cv;
-    thread_ = std::thread{[&, this] {
-      CAF_SET_LOGGER_SYS(&system());
-      detail::set_thread_name("caf.multiplexer");
-      system().thread_started();
-      CAF_LOG_TRACE("");
-      {
-        std::unique_lock<std::mutex> guard{mtx};
-        backend().thread_id(std::this_thread::get_id());
-        init_done = true;
-        cv.notify_one();
+    thread_ = launch_backend(backend());
+    // Additional backends only make sense with a thread per backend.
+    auto num = get_or(config(), "middleman.multiplexer-threads",
+                      defaults::middleman::multiplexer_threads);
+    for (size_t i = 1; i < num; ++i) {
+      auto ptr = make_backend();
+      if (ptr == nullptr) {
+        CAF_LOG_WARNING("backend does not support multiple threads");
+        break;
       }
-      backend().run();
-      system().thread_terminates();
-    }};
-    std::unique_lock<std::mutex> guard{mtx};
-    while (init_done == false)
-      cv.wait(guard);
+      auto sptr = ptr->make_supervisor();
+      if (sptr == nullptr)
+        break;
+      extra_threads_.emplace_back(launch_backend(*ptr));
+      extra_supervisors_.emplace_back(std::move(sptr));
+      extra_backends_.emplace_back(std::move(ptr));
+    }
   }
   // Spawn utility actors.
   auto basp = named_broker<basp_broker>(atom("BASP"));
   manager_ = make_middleman_actor(system(), basp);
+  // Serve metrics via HTTP if the user configured a port for Prometheus.
+  auto prometheus_port = get_or(config(), "middleman.prometheus-http-port",
+                                defaults::middleman::prometheus_http_port);
+  if (prometheus_port != 0) {
+    auto address = get_or(config(), "middleman.prometheus-http-address",
+                          defaults::middleman::prometheus_http_address);
+    auto hdl = spawn_broker<hidden>(prometheus_broker, prometheus_port,
+                                    address);
+    named_brokers_.emplace(atom("Prometheus"), actor_cast<actor>(hdl));
+  }
 }
 
 void middleman::stop() {
@@ -322,8 +382,12 @@ void middleman::stop() {
   });
   if (!get_or(config(), "middleman.manual-multiplexing", false)) {
     backend_supervisor_.reset();
+    extra_supervisors_.clear();
     if (thread_.joinable())
       thread_.join();
+    for (auto& t : extra_threads_)
+      t.join();
+    extra_threads_.clear();
   } else {
     while (backend().try_run_once())
       ; // nop
@@ -53,6 +53,14 @@ byte_buffer& scribe_impl::rd_buf() {
   return stream_.rd_buf();
 }
 
+void scribe_impl::write(byte_buffer buf) {
+  stream_.write(std::move(buf));
+}
+
+void scribe_impl::hand_over(byte_buffer& buf) {
+  stream_.hand_over(buf);
+}
+
 void scribe_impl::graceful_shutdown() {
   CAF_LOG_TRACE("");
   stream_.graceful_shutdown();
@@ -64,10 +64,37 @@ void stream::write(const void* buf, size_t num_bytes) {
   wr_offline_buf_.insert(wr_offline_buf_.end(), first, last);
 }
 
+void stream::write(byte_buffer buf) {
+  CAF_LOG_TRACE(CAF_ARG2("num_bytes", buf.size()));
+  if (buf.size() < min_chunk_size) {
+    wr_offline_buf_.insert(wr_offline_buf_.end(), buf.begin(), buf.end());
+    return;
+  }
+  if (!wr_offline_buf_.empty()) {
+    wr_offline_queue_.emplace_back(std::move(wr_offline_buf_));
+    wr_offline_buf_.clear();
+    wr_offline_buf_.swap(wr_spare_buf_);
+  }
+  wr_offline_queue_.emplace_back(std::move(buf));
+}
+
+void stream::hand_over(byte_buffer& buf) {
+  CAF_LOG_TRACE(CAF_ARG2("num_bytes", buf.size()));
+  if (buf.size() < min_chunk_size) {
+    wr_offline_buf_.insert(wr_offline_buf_.end(), buf.begin(), buf.end());
+  } else {
+    write(std::move(buf));
+    buf.swap(wr_spare_buf_);
+  }
+  buf.clear();
+}
+
 void stream::flush(const manager_ptr& mgr) {
   CAF_ASSERT(mgr != nullptr);
-  CAF_LOG_TRACE(CAF_ARG(wr_offline_buf_.size()));
-  if (!wr_offline_buf_.empty() && !state_.writing) {
+  CAF_LOG_TRACE(CAF_ARG(wr_offline_buf_.size())
+                << CAF_ARG2("chunks", wr_offline_queue_.size()));
+  if ((!wr_offline_buf_.empty() || !wr_offline_queue_.empty())
+      && !state_.writing) {
     backend().add(operation::write, fd(), this);
     writer_ = mgr;
     state_.writing = true;
@@ -134,17 +161,43 @@ void stream::prepare_next_read() {
   }
 }
 
+size_t stream::pending_bytes() const noexcept {
+  auto result = wr_offline_buf_.size();
+  for (auto& buf : wr_queue_)
+    result += buf.size();
+  result -= written_;
+  for (auto& buf : wr_offline_queue_)
+    result += buf.size();
+  return result;
+}
+
+void stream::recycle(byte_buffer& buf) {
+  if (buf.capacity() > wr_spare_buf_.capacity()) {
+    buf.clear();
+    wr_spare_buf_.swap(buf);
+  }
+}
+
 void stream::prepare_next_write() {
-  CAF_LOG_TRACE(CAF_ARG(wr_buf_.size()) << CAF_ARG(wr_offline_buf_.size()));
+  CAF_LOG_TRACE(CAF_ARG2("chunks", wr_queue_.size())
+                << CAF_ARG(wr_offline_buf_.size())
+                << CAF_ARG2("offline_chunks", wr_offline_queue_.size()));
   written_ = 0;
-  wr_buf_.clear();
-  if (wr_offline_buf_.empty()) {
+  for (auto& buf : wr_queue_)
+    recycle(buf);
+  wr_queue_.clear();
+  if (wr_offline_buf_.empty() && wr_offline_queue_.empty()) {
     state_.writing = false;
     backend().del(operation::write, fd(), this);
     if (state_.shutting_down)
       send_fin();
   } else {
-    wr_buf_.swap(wr_offline_buf_);
+    wr_queue_.swap(wr_offline_queue_);
+    if (!wr_offline_buf_.empty()) {
+      wr_queue_.emplace_back(std::move(wr_offline_buf_));
+      wr_offline_buf_.clear();
+      wr_offline_buf_.swap(wr_spare_buf_);
+    }
   }
 }
 
@@ -184,13 +237,17 @@ void stream::handle_write_result(rw_state write_result, size_t wb) {
       break;
     case rw_state::success:
       written_ += wb;
-      CAF_ASSERT(written_ <= wr_buf_.size());
-      auto remaining = wr_buf_.size() - written_;
+      // Drop all chunks we have sent completely.
+      while (!wr_queue_.empty() && written_ >= wr_queue_.front().size()) {
+        written_ -= wr_queue_.front().size();
+        recycle(wr_queue_.front());
+        wr_queue_.pop_front();
+      }
+      CAF_ASSERT(!wr_queue_.empty() || written_ == 0);
       if (state_.ack_writes)
-        writer_->data_transferred(&backend(), wb,
-                                  remaining + wr_offline_buf_.size());
+        writer_->data_transferred(&backend(), wb, pending_bytes());
       // prepare next send (or stop sending)
-      if (remaining == 0)
+      if (wr_queue_.empty())
         prepare_next_write();
       break;
   }
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#include "caf/io/prometheus_broker.hpp"
+
+#include "caf/actor_system.hpp"
+#include "caf/logger.hpp"
+#include "caf/string_algorithms.hpp"
+#include "caf/string_view.hpp"
+#include "caf/telemetry/metric_registry.hpp"
+
+namespace caf::io {
+
+namespace {
+
+// Clients that send more bytes without completing the header get dropped.
+constexpr size_t max_request_size = 4096;
+
+void respond(broker* self, connection_handle hdl, string_view status,
+             const std::string& body) {
+  std::string response = "HTTP/1.1 ";
+  response.insert(response.end(), status.begin(), status.end());
+  response += "\r\n"
+              "Content-Type: text/plain; version=0.0.4\r\n"
+              "Connection: close\r\n"
+              "Content-Length: ";
+  response += std::to_string(body.size());
+  response += "\r\n\r\n";
+  response += body;
+  self->write(hdl, response.size(), response.data());
+  self->flush(hdl);
+  self->close(hdl);
+}
+
+} // namespace
+
+const char* prometheus_broker_state::name = "prometheus_broker";
+
+behavior
+prometheus_broker(stateful_actor<prometheus_broker_state, broker>* self,
+                  uint16_t port, const std::string& address) {
+  auto in = address.empty() ? nullptr : address.c_str();
+  auto res = self->add_tcp_doorman(port, in, true);
+  if (!res) {
+    CAF_LOG_ERROR("unable to open port for Prometheus:" << CAF_ARG(port)
+                                                         << CAF_ARG(address));
+    return {};
+  }
+  CAF_LOG_DEBUG("serve metrics via HTTP:" << CAF_ARG2("port", res->second));
+  return {
+    [=](const new_connection_msg& msg) {
+      self->configure_read(msg.handle, receive_policy::at_most(1024));
+    },
+    [=](const new_data_msg& msg) {
+      auto& requests = self->state.requests;
+      auto& req = requests[msg.handle];
+      req.append(reinterpret_cast<const char*>(msg.buf.data()),
+                 msg.buf.size());
+      if (req.find("\r\n\r\n") == std::string::npos) {
+        if (req.size() > max_request_size) {
+          requests.erase(msg.handle);
+          self->close(msg.handle);
+        }
+        return;
+      }
+      if (starts_with(req, "GET /metrics ")
+          || starts_with(req, "GET /metrics?"))
+        respond(self, msg.handle, "200 OK",
+                self->system().metrics().to_prometheus());
+      else
+        respond(self, msg.handle, "404 Not Found", "Not Found\n");
+      requests.erase(msg.handle);
+    },
+    [=](const connection_closed_msg& msg) {
+      self->state.requests.erase(msg.handle);
+    },
+    [=](const acceptor_closed_msg&) { self->quit(); },
+  };
+}
+
+} // namespace caf::io
@@ -30,6 +30,17 @@ scribe::~scribe() {
   CAF_LOG_TRACE("");
 }
 
+void scribe::write(byte_buffer buf) {
+  auto& out = wr_buf();
+  out.insert(out.end(), buf.begin(), buf.end());
+}
+
+void scribe::hand_over(byte_buffer& buf) {
+  auto& out = wr_buf();
+  out.insert(out.end(), buf.begin(), buf.end());
+  buf.clear();
+}
+
 message scribe::detach_message() {
   return make_message(connection_closed_msg{hdl()});
 }
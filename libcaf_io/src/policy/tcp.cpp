@@ -18,6 +18,8 @@
 
 #include "caf/policy/tcp.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 
 #include "caf/io/network/native_socket.hpp"
@@ -26,8 +28,10 @@
 #ifdef CAF_WINDOWS
 #  include <winsock2.h>
 #else
+#  include <climits>
 #  include <sys/socket.h>
 #  include <sys/types.h>
+#  include <sys/uio.h>
 #endif
 
 using caf::io::network::is_error;
@@ -37,6 +41,7 @@ using caf::io::network::no_sigpipe_io_flag;
 using caf::io::network::rw_state;
 using caf::io::network::socket_error_as_string;
 using caf::io::network::socket_size_type;
+using caf::io::network::would_block_or_temporarily_unavailable;
 
 namespace caf::policy {
 
@@ -78,6 +83,59 @@ tcp::write_some(size_t& result, native_socket fd, const void* buf, size_t len) {
   return rw_state::success;
 }
 
+rw_state tcp::write_some(size_t& result, native_socket fd,
+                         span<const span<const byte>> bufs) {
+  CAF_LOG_TRACE(CAF_ARG(fd) << CAF_ARG2("num_bufs", bufs.size()));
+  static constexpr size_t max_bufs = 64;
+#ifdef CAF_WINDOWS
+  std::array<WSABUF, max_bufs> vec;
+  auto n = std::min(bufs.size(), max_bufs);
+  for (size_t i = 0; i < n; ++i) {
+    vec[i].buf = reinterpret_cast<char*>(const_cast<byte*>(bufs[i].data()));
+    vec[i].len = static_cast<ULONG>(bufs[i].size());
+  }
+  DWORD sent = 0;
+  auto res = WSASend(fd, vec.data(), static_cast<DWORD>(n), &sent, 0, nullptr,
+                     nullptr);
+  if (res == SOCKET_ERROR) {
+    auto err = last_socket_error();
+    if (!would_block_or_temporarily_unavailable(err)) {
+      CAF_LOG_ERROR("WSASend failed:" << socket_error_as_string(err));
+      return rw_state::failure;
+    }
+    sent = 0;
+  }
+  CAF_LOG_DEBUG(CAF_ARG(fd) << CAF_ARG(sent));
+  result = static_cast<size_t>(sent);
+#else
+#  ifdef IOV_MAX
+  static constexpr size_t iov_max = std::min(max_bufs, size_t{IOV_MAX});
+#  else
+  static constexpr size_t iov_max = std::min(max_bufs, size_t{16});
+#  endif
+  std::array<iovec, iov_max> vec;
+  auto n = std::min(bufs.size(), iov_max);
+  for (size_t i = 0; i < n; ++i) {
+    vec[i].iov_base = const_cast<byte*>(bufs[i].data());
+    vec[i].iov_len = bufs[i].size();
+  }
+  msghdr msg;
+  std::memset(&msg, 0, sizeof(msg));
+  msg.msg_iov = vec.data();
+  msg.msg_iovlen = n;
+  auto sres = ::sendmsg(fd, &msg, no_sigpipe_io_flag);
+  if (is_error(sres, true)) {
+    auto err = last_socket_error();
+    CAF_IGNORE_UNUSED(err);
+    CAF_LOG_ERROR("sendmsg failed:" << socket_error_as_string(err));
+    return rw_state::failure;
+  }
+  CAF_LOG_DEBUG(CAF_ARG(fd) << CAF_ARG(sres));
+  result = (sres > 0) ? static_cast<size_t>(sres) : 0;
+#endif
+  return rw_state::success;
+}
+
 bool tcp::try_accept(native_socket& result, native_socket fd) {
   using namespace io::network;
   CAF_LOG_TRACE(CAF_ARG(fd));
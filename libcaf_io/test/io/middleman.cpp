@@ -0,0 +1,119 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE io.middleman
+
+#include "caf/io/middleman.hpp"
+
+#include "caf/test/dsl.hpp"
+
+#include <set>
+#include <string>
+
+#include "caf/all.hpp"
+#include "caf/io/all.hpp"
+
+using namespace caf;
+using namespace caf::io;
+
+namespace {
+
+using backend_atom = atom_constant<atom("backend")>;
+
+struct config : actor_system_config {
+  config() {
+    load<middleman>();
+    set("middleman.multiplexer-threads", 3);
+    set("scheduler.max-threads", 2);
+  }
+};
+
+struct fixture {
+  config cfg;
+  actor_system sys{cfg};
+  scoped_actor self{sys};
+  middleman& mm = sys.middleman();
+};
+
+behavior backend_reporter(broker* self) {
+  return {
+    [=](backend_atom) {
+      auto ptr = reinterpret_cast<uintptr_t>(&self->backend());
+      self->quit();
+      return static_cast<uint64_t>(ptr);
+    },
+  };
+}
+
+behavior echo_server(broker* self) {
+  return {
+    [=](const new_connection_msg& msg) {
+      self->configure_read(msg.handle, receive_policy::exactly(5));
+    },
+    [=](const new_data_msg& msg) {
+      self->write(msg.handle, msg.buf.size(), msg.buf.data());
+      self->flush(msg.handle);
+    },
+    [=](const connection_closed_msg&) { self->quit(); },
+  };
+}
+
+behavior echo_client(broker* self, connection_handle hdl, actor buddy) {
+  self->configure_read(hdl, receive_policy::exactly(5));
+  std::string str = "hello";
+  self->write(hdl, str.size(), str.data());
+  self->flush(hdl);
+  return {
+    [=](const new_data_msg& msg) {
+      std::string str;
+      for (auto x : msg.buf)
+        str += static_cast<char>(x);
+      self->send(buddy, str);
+      self->quit();
+    },
+  };
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(middleman_tests, fixture)
+
+CAF_TEST(the middleman runs one multiplexer per configured thread) {
+  CAF_REQUIRE_EQUAL(mm.num_backends(), 3u);
+  std::set<uint64_t> backends;
+  for (size_t i = 0; i < 3; ++i) {
+    auto hdl = mm.spawn_broker(backend_reporter);
+    self->request(hdl, infinite, backend_atom::value)
+      .receive([&](uint64_t x) { backends.emplace(x); },
+               [&](error& err) { CAF_FAIL(sys.render(err)); });
+  }
+  CAF_CHECK_EQUAL(backends.size(), 3u);
+}
+
+CAF_TEST(brokers on different multiplexers communicate) {
+  uint16_t port = 0;
+  auto server = unbox(mm.spawn_server(echo_server, port));
+  auto client = unbox(mm.spawn_client(echo_client, "127.0.0.1", port,
+                                      actor{self}));
+  self->receive([](const std::string& str) { CAF_CHECK_EQUAL(str, "hello"); },
+                after(std::chrono::seconds(10)) >>
+                  [] { CAF_FAIL("client received no echo"); });
+  anon_send_exit(server, exit_reason::user_shutdown);
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -28,6 +28,12 @@
 #include "caf/all.hpp"
 #include "caf/io/all.hpp"
 #include "caf/io/network/operation.hpp"
+#include "caf/io/network/scribe_impl.hpp"
+#include "caf/policy/tcp.hpp"
+
+#ifndef CAF_WINDOWS
+#  include <sys/socket.h>
+#endif
 
 using namespace caf;
 
@@ -61,6 +67,26 @@ struct fixture {
   }
 };
 
+#ifndef CAF_WINDOWS
+
+byte_buffer make_buffer(size_t size, char fill) {
+  return byte_buffer(size, static_cast<byte>(fill));
+}
+
+// Reads everything currently available on `fd`.
+byte_buffer read_all(io::network::native_socket fd) {
+  byte_buffer result;
+  byte_buffer buf(4096);
+  size_t rb = 0;
+  while (policy::tcp::read_some(rb, fd, buf.data(), buf.size())
+           == io::network::rw_state::success
+         && rb > 0)
+    result.insert(result.end(), buf.begin(), buf.begin() + rb);
+  return result;
+}
+
+#endif // CAF_WINDOWS
+
 } // namespace
 
 CAF_TEST_FIXTURE_SCOPE(default_multiplexer_tests, fixture)
@@ -79,4 +105,96 @@ CAF_TEST(doorman io_failure) {
   CAF_CHECK_EQUAL(server.mpx.num_socket_handlers(), 1u);
 }
 
+#ifndef CAF_WINDOWS
+
+CAF_TEST(tcp policy writes multiple buffers at once) {
+  int fds[2];
+  CAF_REQUIRE_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  CAF_CHECK(io::network::nonblocking(fds[1], true));
+  auto xs = make_buffer(10, 'a');
+  auto ys = make_buffer(20, 'b');
+  std::vector<span<const byte>> bufs{make_span(xs), make_span(ys)};
+  size_t wb = 0;
+  auto res = policy::tcp::write_some(wb, fds[0], make_span(bufs));
+  CAF_CHECK_EQUAL(res, io::network::rw_state::success);
+  CAF_CHECK_EQUAL(wb, 30u);
+  auto data = read_all(fds[1]);
+  auto expected = xs;
+  expected.insert(expected.end(), ys.begin(), ys.end());
+  CAF_CHECK_EQUAL(data, expected);
+  io::network::close_socket(fds[0]);
+  io::network::close_socket(fds[1]);
+}
+
+CAF_TEST(scribes send buffers and write buffer content in order) {
+  int fds[2];
+  CAF_REQUIRE_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  CAF_CHECK(io::network::nonblocking(fds[0], true));
+  CAF_CHECK(io::network::nonblocking(fds[1], true));
+  auto hdl = make_counted<io::network::scribe_impl>(client.mpx, fds[0]);
+  auto& out = hdl->wr_buf();
+  byte_buffer expected;
+  auto append = [&](const byte_buffer& xs) {
+    expected.insert(expected.end(), xs.begin(), xs.end());
+  };
+  auto small = make_buffer(10, 'a');
+  out.insert(out.end(), small.begin(), small.end());
+  append(small);
+  auto large = make_buffer(io::network::stream::min_chunk_size * 4, 'b');
+  append(large);
+  hdl->write(std::move(large));
+  auto tiny = make_buffer(3, 'c');
+  append(tiny);
+  hdl->write(std::move(tiny));
+  auto more = make_buffer(io::network::stream::min_chunk_size, 'd');
+  append(more);
+  hdl->write(std::move(more));
+  hdl->flush();
+  client.mpx.handle_internal_events();
+  client.exec_all();
+  CAF_CHECK_EQUAL(read_all(fds[1]), expected);
+  hdl->remove_from_loop();
+  client.mpx.handle_internal_events();
+  io::network::close_socket(fds[1]);
+}
+
+CAF_TEST(scribes hand over large buffers and return recycled buffers) {
+  int fds[2];
+  CAF_REQUIRE_EQUAL(socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  CAF_CHECK(io::network::nonblocking(fds[0], true));
+  CAF_CHECK(io::network::nonblocking(fds[1], true));
+  auto hdl = make_counted<io::network::scribe_impl>(client.mpx, fds[0]);
+  byte_buffer expected;
+  auto small = make_buffer(10, 'a');
+  expected.insert(expected.end(), small.begin(), small.end());
+  auto small_data = small.data();
+  hdl->hand_over(small);
+  CAF_CHECK(small.empty());
+  CAF_CHECK_EQUAL(small.data(), small_data);
+  auto large = make_buffer(io::network::stream::min_chunk_size * 4, 'b');
+  expected.insert(expected.end(), large.begin(), large.end());
+  hdl->hand_over(large);
+  CAF_CHECK(large.empty());
+  hdl->flush();
+  client.mpx.handle_internal_events();
+  client.exec_all();
+  CAF_CHECK_EQUAL(read_all(fds[1]), expected);
+  CAF_MESSAGE("after the first write, the stream returns spare buffers");
+  auto again = make_buffer(io::network::stream::min_chunk_size * 4, 'c');
+  hdl->hand_over(again);
+  CAF_CHECK(again.empty());
+  CAF_CHECK_GREATER_OR_EQUAL(again.capacity(),
+                             io::network::stream::min_chunk_size * 4);
+  hdl->flush();
+  client.mpx.handle_internal_events();
+  client.exec_all();
+  CAF_CHECK_EQUAL(read_all(fds[1]),
+                  make_buffer(io::network::stream::min_chunk_size * 4, 'c'));
+  hdl->remove_from_loop();
+  client.mpx.handle_internal_events();
+  io::network::close_socket(fds[1]);
+}
+
+#endif // CAF_WINDOWS
+
 CAF_TEST_FIXTURE_SCOPE_END()
@@ -0,0 +1,109 @@
+/******************************************************************************
+ *                       ____    _    _____                                   *
+ *                      / ___|  / \  |  ___|    C++                           *
+ *                     | |     / _ \ | |_       Actor                         *
+ *                     | |___ / ___ \|  _|      Framework                     *
+ *                      \____/_/   \_|_|                                      *
+ *                                                                            *
+ * Copyright 2011-2018 Dominik Charousset                                     *
+ *                                                                            *
+ * Distributed under the terms and conditions of the BSD 3-Clause License or  *
+ * (at your option) under the terms and conditions of the Boost Software      *
+ * License 1.0. See accompanying files LICENSE and LICENSE_ALTERNATIVE.       *
+ *                                                                            *
+ * If you did not receive a copy of the license files, see                    *
+ * http://opensource.org/licenses/BSD-3-Clause and                            *
+ * http://www.boost.org/LICENSE_1_0.txt.                                      *
+ ******************************************************************************/
+
+#define CAF_SUITE io.prometheus_broker
+
+#include "caf/io/prometheus_broker.hpp"
+
+#include "caf/test/unit_test.hpp"
+
+#include <string>
+
+#include "caf/all.hpp"
+#include "caf/io/all.hpp"
+#include "caf/io/network/test_multiplexer.hpp"
+
+using namespace caf;
+using namespace caf::io;
+
+namespace {
+
+constexpr uint16_t port = 9090;
+
+struct config : actor_system_config {
+  config() {
+    load<io::middleman, network::test_multiplexer>();
+    set("metrics.enable", true);
+  }
+};
+
+struct fixture {
+  fixture() {
+    mpx = dynamic_cast<network::test_multiplexer*>(&sys.middleman().backend());
+    CAF_REQUIRE(mpx != nullptr);
+    mpx->provide_acceptor(port, acceptor);
+    aut = sys.middleman().spawn_broker(prometheus_broker, port, "");
+    mpx->flush_runnables();
+    mpx->add_pending_connect(acceptor, connection);
+    mpx->accept_connection(acceptor);
+  }
+
+  ~fixture() {
+    anon_send_exit(aut, exit_reason::kill);
+    mpx->flush_runnables();
+  }
+
+  // Sends `request` to the broker and returns everything it wrote back.
+  std::string query(string_view request) {
+    auto bytes = as_bytes(make_span(request));
+    mpx->virtual_send(connection, byte_buffer{bytes.begin(), bytes.end()});
+    auto& buf = mpx->output_buffer(connection);
+    std::string result{reinterpret_cast<const char*>(buf.data()), buf.size()};
+    buf.clear();
+    return result;
+  }
+
+  config cfg;
+  actor_system sys{cfg};
+  network::test_multiplexer* mpx;
+  actor aut;
+  accept_handle acceptor = accept_handle::from_int(1);
+  connection_handle connection = connection_handle::from_int(1);
+};
+
+bool contains(const std::string& str, string_view what) {
+  return str.find(what.data(), 0, what.size()) != std::string::npos;
+}
+
+} // namespace
+
+CAF_TEST_FIXTURE_SCOPE(prometheus_broker_tests, fixture)
+
+CAF_TEST(the broker serves metrics in the Prometheus text format) {
+  sys.metrics().counter_instance("test_total", {}, "Test.")->inc(42);
+  auto response = query("GET /metrics HTTP/1.1\r\n"
+                         "Host: localhost\r\n"
+                         "\r\n");
+  CAF_CHECK(starts_with(response, "HTTP/1.1 200 OK\r\n"));
+  CAF_CHECK(contains(response, "\r\n\r\n# HELP "));
+  CAF_CHECK(contains(response, "\ntest_total 42\n"));
+  CAF_CHECK(contains(response, "# TYPE caf_scheduler_resumed_jobs_total"));
+}
+
+CAF_TEST(the broker waits for the full request header) {
+  CAF_CHECK_EQUAL(query("GET /metrics HTTP/1.1\r\n"), "");
+  auto response = query("\r\n");
+  CAF_CHECK(starts_with(response, "HTTP/1.1 200 OK\r\n"));
+}
+
+CAF_TEST(the broker rejects unknown paths) {
+  auto response = query("GET /index.html HTTP/1.1\r\n\r\n");
+  CAF_CHECK(starts_with(response, "HTTP/1.1 404 Not Found\r\n"));
+}
+
+CAF_TEST_FIXTURE_SCOPE_END()
@@ -133,6 +133,14 @@ public:
     return stream_.rd_buf();
   }
 
+  void write(byte_buffer buf) override {
+    stream_.write(std::move(buf));
+  }
+
+  void hand_over(byte_buffer& buf) override {
+    stream_.hand_over(buf);
+  }
+
   void graceful_shutdown() override {
     CAF_LOG_TRACE("");
     stream_.graceful_shutdown();